@@ -36,6 +36,7 @@ All text above, and the splash screen must be included in any redistribution
 
 #include "Adafruit_GFX.h"
 #include "ESP8266_SSD1322.h"
+#include "SSD1322_RasterOps.h"
 
 #ifndef _swap_int16_t
 #define _swap_int16_t(a, b) { int16_t t = a; a = b; b = t; }
@@ -65,18 +66,106 @@ All text above, and the splash screen must be included in any redistribution
   #include "Font10.h"
 #endif
 
+// The fonts Load_fonts.h brings in, by size number
+#ifdef LOAD_FONT2
+static const SSD1322_Font font2 = { firstchr_f16, nr_chrs_f16, chr_hgt_f16, 1, widtbl_f16, chrtbl_f16, enc_f16, NULL, NULL, NULL, 0 };
+  #define FONT2 &font2
+#else
+  #define FONT2 NULL
+#endif
+#ifdef LOAD_FONT4
+static const SSD1322_Font font4 = { firstchr_f32, nr_chrs_f32, chr_hgt_f32, -3, NULL, NULL, enc_f32, idxtbl_f32, chrdat_f32, NULL, 0 };
+  #define FONT4 &font4
+#else
+  #define FONT4 NULL
+#endif
+#ifdef LOAD_FONT6
+static const SSD1322_Font font6 = { firstchr_f64, nr_chrs_f64, chr_hgt_f64, -3, NULL, NULL, enc_f64, idxtbl_f64, chrdat_f64, NULL, 0 };
+  #define FONT6 &font6
+#else
+  #define FONT6 NULL
+#endif
+#ifdef LOAD_FONT7
+static const SSD1322_Font font7 = { firstchr_f7s, nr_chrs_f7s, chr_hgt_f7s, 2, NULL, NULL, enc_f7s, idxtbl_f7s, chrdat_f7s, NULL, 0 };
+  #define FONT7 &font7
+#else
+  #define FONT7 NULL
+#endif
+#ifdef LOAD_FONT8
+static const SSD1322_Font font8 = { 32, 96, chr_hgt_F10, gap_F10, widtbl_F10, chrtbl_F10, SSD1322_FONT_BITMAP, NULL, NULL, NULL, 0 };
+  #define FONT8 &font8
+#else
+  #define FONT8 NULL
+#endif
+
+// Size number to font, 0 being the GLCD font of Adafruit_GFX
+static const SSD1322_Font *fontTable[SSD1322_MAX_FONTS] = {
+  NULL, NULL, FONT2, NULL, FONT4, NULL, FONT6, FONT7, FONT8
+};
+
 // the memory buffer for the LCD
 static uint8_t buffer[SSD1322_LCDHEIGHT * SSD1322_LCDWIDTH / (8 / SSD1322_BITS_PER_PIXEL)] = { 0x00 };
 
-// the most basic function, set a single pixel
-void ESP8266_SSD1322::drawPixel(int16_t x, int16_t y, uint16_t gscale)
+// buffer geometry: the panel, or the logical (rotated) screen when rotation is applied at flush time
+static int16_t bufWidth = SSD1322_LCDWIDTH;
+static int16_t bufHeight = SSD1322_LCDHEIGHT;
+static uint16_t bufStride = SSD1322_LCDWIDTH * SSD1322_BITS_PER_PIXEL / 8; // bytes per row
+
+// raster-op kernels indexed by SSD1322_ROP_*, NORMAL is resolved before it gets here
+static const RopSpanFn ropSpanTable[] = {
+	ropSpan<SSD1322_ROP_COPY>, ropSpan<SSD1322_ROP_COPY>, ropSpan<SSD1322_ROP_SET>,
+	ropSpan<SSD1322_ROP_CLEAR>, ropSpan<SSD1322_ROP_XOR>, ropSpan<SSD1322_ROP_AND>,
+	ropSpan<SSD1322_ROP_OR>, ropSpan<SSD1322_ROP_MAX>, ropSpan<SSD1322_ROP_MIN>,
+	ropSpan<SSD1322_ROP_ADDS>
+};
+
+static const RopColumnFn ropColumnTable[] = {
+	ropColumn<SSD1322_ROP_COPY>, ropColumn<SSD1322_ROP_COPY>, ropColumn<SSD1322_ROP_SET>,
+	ropColumn<SSD1322_ROP_CLEAR>, ropColumn<SSD1322_ROP_XOR>, ropColumn<SSD1322_ROP_AND>,
+	ropColumn<SSD1322_ROP_OR>, ropColumn<SSD1322_ROP_MAX>, ropColumn<SSD1322_ROP_MIN>,
+	ropColumn<SSD1322_ROP_ADDS>
+};
+
+static const RopLineFn ropLineSteepTable[] = {
+	ropLineSteep<SSD1322_ROP_COPY>, ropLineSteep<SSD1322_ROP_COPY>, ropLineSteep<SSD1322_ROP_SET>,
+	ropLineSteep<SSD1322_ROP_CLEAR>, ropLineSteep<SSD1322_ROP_XOR>, ropLineSteep<SSD1322_ROP_AND>,
+	ropLineSteep<SSD1322_ROP_OR>, ropLineSteep<SSD1322_ROP_MAX>, ropLineSteep<SSD1322_ROP_MIN>,
+	ropLineSteep<SSD1322_ROP_ADDS>
+};
+
+// Run a span kernel over buffer pixels x .. x + w - 1 of row y, already clipped.
+// Works in bits so the same masks cover both pixel formats.
+static void fillSpan(RopSpanFn kernel, int16_t x, int16_t y, int16_t w, uint8_t src)
+{
+	register uint16_t b0 = x * SSD1322_BITS_PER_PIXEL;
+	register uint16_t b1 = (x + w) * SSD1322_BITS_PER_PIXEL;
+	register uint8_t *pBuf = &buffer[(b0 >> 3) + (y * bufStride)];
+	register uint8_t firstMask = (b0 & 7) ? (0xFF >> (b0 & 7)) : 0;
+	register uint8_t lastMask = (b1 & 7) ? ~(0xFF >> (b1 & 7)) : 0;
+	register uint16_t n = (b1 >> 3) - (b0 >> 3);
+
+	if (firstMask)
+	{
+		if (n == 0)
+		{
+			// starts and ends in the same byte
+			firstMask &= lastMask;
+			lastMask = 0;
+		}
+		else
+		{
+			n--;
+		}
+	}
+
+	kernel(pBuf, src, firstMask, n, lastMask);
+}
+
+// Map screen coordinates to buffer coordinates for the current rotation
+// (nothing to do when the buffer is kept in the rotated orientation)
+inline void ESP8266_SSD1322::toBuffer(int16_t &x, int16_t &y)
 {
-//Serial.print("x=");
-//Serial.println(x);
-//Serial.print("y=");
-//Serial.println(y);
-  // check rotation, move pixel around if necessary
-  switch (getRotation())
+  switch (flushRotation ? 0 : getRotation())
   {
     case 1:
       _swap_int16_t(x, y);
@@ -91,34 +180,81 @@ void ESP8266_SSD1322::drawPixel(int16_t x, int16_t y, uint16_t gscale)
       y = HEIGHT - y - 1;
     break;
   }
+}
+
+// the most basic function, set a single pixel
+void ESP8266_SSD1322::drawPixel(int16_t x, int16_t y, uint16_t gscale)
+{
+  toBuffer(x, y);
 
-  if ((x < 0) || (x >= width()) || (y < 0) || (y >= height()))
+  if ((x < 0) || (x >= bufWidth) || (y < 0) || (y >= bufHeight))
     return;
 
-//Serial.print("x2=");
-//Serial.println(x);
-//  Serial.print("y2=");
-//  Serial.println(y);
+  uint8_t op, src;
+  resolveRop(gscale, op, src);
 
 #ifdef SSD1322_256_64_4 // 4 bits per pixel
-	register uint8_t mask = ((x % 2) ? gscale : gscale << 4);
-	register uint8_t *pBuf = &buffer[(x >> 1) + (y * (SSD1322_LCDWIDTH / 2))];
-	register uint8_t b1 = *pBuf;
-	b1 &= (x % 2) ? 0xF0 : 0x0F; // cleardown nibble to be replaced
-	// write our value in
-	*pBuf++ = b1 | mask;
+	register uint8_t *pBuf = &buffer[(x >> 1) + (y * bufStride)];
+	*pBuf = ropApply(op, *pBuf, src, (x % 2) ? 0x0F : 0xF0);
 #endif
 #ifdef SSD1322_256_64_1 // 1 bit per pixel
-  register uint8_t *pBuf = &buffer[(x >> 3) + (y * (SSD1322_LCDWIDTH / 8))];
-  switch (gscale)
-  {
-    case WHITE:	*pBuf |=  (0x80 >> (x%8)); break;
-    case BLACK:	*pBuf &= ~(0x80 >> (x%8)); break;
-    case INVERSE:	*pBuf ^=  (0x80 >> (x%8)); break;
-  }
+  register uint8_t *pBuf = &buffer[(x >> 3) + (y * bufStride)];
+  *pBuf = ropApply(op, *pBuf, src, 0x80 >> (x%8));
 #endif
 
 }
+
+/**
+ * Select how subsequent drawing combines with the frame buffer.
+ * @param op - one of the SSD1322_ROP_* values.  SSD1322_ROP_NORMAL (the
+ * default) keeps the classic behaviour where the colour picks the operation.
+ * Every other op uses the colour as source: WHITE/BLACK in 1 bit mode, the
+ * gray level in 4 bit mode.
+ */
+void ESP8266_SSD1322::setRasterOp(uint8_t op)
+{
+	rasterOp = (op <= SSD1322_ROP_ADDS) ? op : SSD1322_ROP_NORMAL;
+}
+
+uint8_t ESP8266_SSD1322::getRasterOp(void)
+{
+	return rasterOp;
+}
+
+// The text settings, for code that draws and then puts them back
+uint8_t ESP8266_SSD1322::getTextSize(void)
+{
+	return textsize;
+}
+
+uint16_t ESP8266_SSD1322::getTextColor(void)
+{
+	return textcolor;
+}
+
+uint16_t ESP8266_SSD1322::getTextBgColor(void)
+{
+	return textbgcolor;
+}
+
+// Turn a colour into the kernel to run and the source byte to feed it,
+// once per primitive so the inner loops never look at the colour again.
+void ESP8266_SSD1322::resolveRop(uint16_t color, uint8_t &op, uint8_t &src)
+{
+#ifdef SSD1322_256_64_4
+	src = (color & 0x0F) * 0x11;
+	op = (rasterOp == SSD1322_ROP_NORMAL) ? SSD1322_ROP_COPY : rasterOp;
+#endif
+#ifdef SSD1322_256_64_1
+	src = (color == BLACK) ? 0x00 : 0xFF;
+	op = rasterOp;
+	if (op == SSD1322_ROP_NORMAL)
+	{
+		op = (color == INVERSE) ? SSD1322_ROP_XOR : SSD1322_ROP_COPY;
+	}
+#endif
+}
+
 ESP8266_SSD1322::ESP8266_SSD1322(int8_t SID, int8_t SCLK, int8_t DC,
 		int8_t RST, int8_t CS) :
 		Adafruit_GFX(SSD1322_LCDWIDTH, SSD1322_LCDHEIGHT) {
@@ -128,6 +264,8 @@ ESP8266_SSD1322::ESP8266_SSD1322(int8_t SID, int8_t SCLK, int8_t DC,
 	sclk = SCLK;
 	sid = SID;
 	hwSPI = false;
+	rasterOp = SSD1322_ROP_NORMAL;
+	flushRotation = remapFlipped = false;
 }
 
 // constructor for hardware SPI - we indicate DataCommand, ChipSelect, Reset
@@ -137,6 +275,8 @@ ESP8266_SSD1322::ESP8266_SSD1322(int8_t DC, int8_t RST, int8_t CS) :
 	rst = RST;
 	cs = CS;
 	hwSPI = true;
+	rasterOp = SSD1322_ROP_NORMAL;
+	flushRotation = remapFlipped = false;
 }
 
 // initializer for I2C - we only indicate the reset pin!
@@ -144,6 +284,8 @@ ESP8266_SSD1322::ESP8266_SSD1322(int8_t reset) :
 		Adafruit_GFX(SSD1322_LCDWIDTH, SSD1322_LCDHEIGHT) {
 	sclk = dc = cs = sid = -1;
 	rst = reset;
+	rasterOp = SSD1322_ROP_NORMAL;
+	flushRotation = remapFlipped = false;
 }
 
 /* ------------------------------------------------------------
@@ -199,6 +341,10 @@ void ESP8266_SSD1322::begin(uint8_t i2caddr, bool reset) {
 	ssd1322_command(SSD1322_SETREMAP);// 0xA0
 	ssd1322_data(0x14);//Horizontal address increment,Disable Column Address Re-map,Enable Nibble Re-map,Scan from COM[N-1] to COM0,Disable COM Split Odd Even
 	ssd1322_data(0x11);//Enable Dual COM mode
+	remapFlipped = false;
+#ifdef SSD1322_256_64_4
+	frcImage = NULL;
+#endif
 
 	ssd1322_command(SSD1322_SETGPIO);// 0xB5
 	ssd1322_data(0x00);// Disable GPIO Pins Input
@@ -377,8 +523,75 @@ void ESP8266_SSD1322::ssd1322_dataBytes(uint8_t *buf, uint32_t size) {
 	}
 }
 
+#ifdef SSD1322_256_64_1
+// 1 bit per pixel to the panel's 4 bits per pixel, each source byte becomes four bytes
+static void expandMono(const uint8_t *src, uint8_t *dst, uint16_t n)
+{
+	static const uint8_t pairs[4] = { 0x00, 0x0F, 0xF0, 0xFF };
+
+	while (n--)
+	{
+		register uint8_t b = *src++;
+		*dst++ = pairs[b >> 6];
+		*dst++ = pairs[(b >> 4) & 0x03];
+		*dst++ = pairs[(b >> 2) & 0x03];
+		*dst++ = pairs[b & 0x03];
+	}
+}
+#endif
+
+/**
+ * Keep the buffer in the rotated (logical) orientation and apply the rotation
+ * once per display() instead of on every pixel.  90 and 270 degrees are
+ * transposed block by block while flushing, 180 degrees is done by the
+ * controller's column and COM remap at no cost.
+ * The buffer layout changes, so clear and redraw after switching.
+ * @param enable - true to rotate at flush time, false to rotate per pixel.
+ */
+void ESP8266_SSD1322::setFlushRotation(boolean enable)
+{
+	flushRotation = enable;
+	updateGeometry();
+}
+
+void ESP8266_SSD1322::setRotation(uint8_t r)
+{
+	Adafruit_GFX::setRotation(r);
+	updateGeometry();
+}
+
+void ESP8266_SSD1322::updateGeometry(void)
+{
+	if (flushRotation && (rotation & 1))
+	{
+		bufWidth = SSD1322_LCDHEIGHT;
+		bufHeight = SSD1322_LCDWIDTH;
+	}
+	else
+	{
+		bufWidth = SSD1322_LCDWIDTH;
+		bufHeight = SSD1322_LCDHEIGHT;
+	}
+	bufStride = bufWidth * SSD1322_BITS_PER_PIXEL / 8;
+}
+
+// Switch the controller's column and COM scan to 180 degrees or back
+void ESP8266_SSD1322::setRemap(boolean flip)
+{
+	if (flip != remapFlipped)
+	{
+		ssd1322_command(SSD1322_SETREMAP);// 0xA0
+		ssd1322_data(flip ? 0x06 : 0x14);// Column Address Re-map on/off, COM scan direction reversed
+		ssd1322_data(0x11);//Enable Dual COM mode
+		remapFlipped = flip;
+	}
+}
+
 void ESP8266_SSD1322::display() {
 
+	// 180 degrees at flush time: let the controller scan columns and COMs backwards
+	setRemap(flushRotation && (rotation == 2));
+
     ssd1322_command(SSD1322_SETCOLUMNADDR);
     ssd1322_data(MIN_SEG);
     ssd1322_data(MAX_SEG);
@@ -389,6 +602,12 @@ void ESP8266_SSD1322::display() {
 
     ssd1322_command(SSD1322_WRITERAM);
 
+	if (flushRotation && (rotation & 1))
+	{
+		displayTransposed();
+		return;
+	}
+
     register uint16_t bufSize = (SSD1322_LCDHEIGHT * SSD1322_LCDWIDTH / (8 / SSD1322_BITS_PER_PIXEL)); // bytes
 	register uint8_t *pBuf = buffer;
 
@@ -399,31 +618,156 @@ void ESP8266_SSD1322::display() {
 #endif
 #ifdef SSD1322_256_64_1
 	uint16_t srcIndex = 0;
+	uint8_t destArray[64];
 
 	while (srcIndex < bufSize)
 	{
-		uint8_t destIndex = 0;
-		uint8_t destArray[64] = {0};
+		expandMono(&pBuf[srcIndex], destArray, 16);
+		srcIndex += 16;
+
+		// Send to display here.
+		ssd1322_dataBytes(destArray, 64);
+	}
+#endif
+}
+
+/**
+ * Send only the part of the buffer under screen rectangle r, widened to the
+ * controller's 4 pixel column units.  A full display() is done instead while
+ * setFlushRotation() turns the buffer at flush time.
+ */
+void ESP8266_SSD1322::displayRect(const SSD1322_Rect &r)
+{
+	int16_t x0, y0, x1, y1;
+
+	if (flushRotation && rotation)
+	{
+		display();
+		return;
+	}
+	if (!bufferRect(r, x0, y0, x1, y1))
+	{
+		return;
+	}
+	if (remapFlipped)
+	{
+		// left over from a 180 degree flush rotation
+		display();
+		return;
+	}
+
+	uint8_t c0 = x0 >> 2;
+	uint8_t c1 = x1 >> 2;
+
+	ssd1322_command(SSD1322_SETCOLUMNADDR);
+	ssd1322_data(MIN_SEG + c0);
+	ssd1322_data(MIN_SEG + c1);
+
+	ssd1322_command(SSD1322_SETROWADDR);
+	ssd1322_data(y0);
+	ssd1322_data(y1);
+
+	ssd1322_command(SSD1322_WRITERAM);
+
+	for (int16_t y = y0; y <= y1; y++)
+	{
+#ifdef SSD1322_256_64_4
+		ssd1322_dataBytes(&buffer[y * bufStride + c0 * 2], (c1 - c0 + 1) * 2);
+#endif
+#ifdef SSD1322_256_64_1
+		// a column unit is half a buffer byte, expand whole bytes and skip the first half if need be
+		uint8_t destArray[SSD1322_LCDWIDTH / 2];
+		uint8_t b0 = c0 >> 1;
+		uint8_t b1 = c1 >> 1;
+
+		expandMono(&buffer[y * bufStride + b0], destArray, b1 - b0 + 1);
+		ssd1322_dataBytes(destArray + (c0 & 1) * 2, (c1 - c0 + 1) * 2);
+#endif
+	}
+}
+
+// Flush the 64 pixel wide portrait buffer (rotation 1 or 3) as panel rows.
+// Panel pixel (px, py) is buffer pixel (py, 255 - px) for rotation 1
+// and (63 - py, px) for rotation 3.
+void ESP8266_SSD1322::displayTransposed(void)
+{
+#ifdef SSD1322_256_64_1
+	// 8 panel rows at a time, each 8x8 block is one bit-matrix transpose
+	uint8_t band[8][SSD1322_LCDWIDTH / 8];
+	uint8_t destArray[SSD1322_LCDWIDTH / 2];
+	uint8_t block[8];
+	uint8_t flip = (rotation == 1) ? 0 : 7; // rotation 3 reads the block bottom up
+
+	for (uint8_t py = 0; py < SSD1322_LCDHEIGHT; py += 8)
+	{
+		register const uint8_t *pBuf;
+		register int16_t step;
 
-		while (destIndex < 64)
+		if (rotation == 1)
+		{
+			pBuf = &buffer[(SSD1322_LCDWIDTH - 1) * bufStride + (py >> 3)];
+			step = -bufStride;
+		}
+		else
 		{
-			uint8_t mask = 0x80;
+			pBuf = &buffer[(SSD1322_LCDHEIGHT - 8 - py) >> 3];
+			step = bufStride;
+		}
 
-			while (mask > 0)
+		for (uint8_t bx = 0; bx < SSD1322_LCDWIDTH / 8; bx++)
+		{
+			for (uint8_t i = 0; i < 8; i++)
+			{
+				block[i] = *pBuf;
+				pBuf += step;
+			}
+			transpose8(block, block);
+			for (uint8_t r = 0; r < 8; r++)
 			{
-				// upper nibble
-				destArray[destIndex] |= (pBuf[srcIndex] & mask) ? 0xf0 : 0x00;
-				//shift mask to next bit, but this goes into lower nibble.
-				mask >>= 1;
-				destArray[destIndex] |= (pBuf[srcIndex] & mask) ? 0x0f : 0x00;
-
-				destIndex++;
-				mask >>= 1;
+				band[r ^ flip][bx] = block[r];
 			}
-			srcIndex++;
 		}
-		// Send to display here.
-		ssd1322_dataBytes(destArray, 64);
+
+		for (uint8_t r = 0; r < 8; r++)
+		{
+			expandMono(band[r], destArray, SSD1322_LCDWIDTH / 8);
+			ssd1322_dataBytes(destArray, SSD1322_LCDWIDTH / 2);
+		}
+	}
+#endif
+#ifdef SSD1322_256_64_4
+	// 2 panel rows at a time, each 2x2 block is a nibble transpose
+	uint8_t rows[2][SSD1322_LCDWIDTH / 2];
+	uint8_t *hiRow = rows[(rotation == 1) ? 0 : 1];
+	uint8_t *loRow = rows[(rotation == 1) ? 1 : 0];
+
+	for (uint8_t py = 0; py < SSD1322_LCDHEIGHT; py += 2)
+	{
+		register const uint8_t *pA;
+		register int16_t step;
+
+		if (rotation == 1)
+		{
+			pA = &buffer[(SSD1322_LCDWIDTH - 1) * bufStride + (py >> 1)];
+			step = -bufStride;
+		}
+		else
+		{
+			pA = &buffer[(SSD1322_LCDHEIGHT - 2 - py) >> 1];
+			step = bufStride;
+		}
+
+		for (uint8_t j = 0; j < SSD1322_LCDWIDTH / 2; j++)
+		{
+			register uint8_t a = pA[0];
+			register uint8_t b = pA[step];
+
+			hiRow[j] = (a & 0xF0) | (b >> 4);
+			loRow[j] = (a << 4) | (b & 0x0F);
+			pA += 2 * step;
+		}
+
+		ssd1322_dataBytes(rows[0], SSD1322_LCDWIDTH);
 	}
 #endif
 }
@@ -463,8 +807,15 @@ inline void ESP8266_SSD1322::fastSPIwriteBytes(uint8_t * data, uint32_t const si
 
 void ESP8266_SSD1322::drawFastHLine(int16_t x, int16_t y, int16_t w,
 		uint16_t color) {
+	uint8_t op, src;
+	resolveRop(color, op, src);
+	hspan(x, y, w, op, src);
+}
+
+// Horizontal run in screen coordinates, the raster op already resolved
+void ESP8266_SSD1322::hspan(int16_t x, int16_t y, int16_t w, uint8_t op, uint8_t src) {
 	boolean bSwap = false;
-	switch (rotation) {
+	switch (flushRotation ? 0 : rotation) {
 	case 0:
 		// 0 degree rotation, do nothing
 		break;
@@ -492,16 +843,16 @@ void ESP8266_SSD1322::drawFastHLine(int16_t x, int16_t y, int16_t w,
 	}
 
 	if (bSwap) {
-		drawFastVLineInternal(x, y, w, color);
+		drawFastVLineInternal(x, y, w, op, src);
 	} else {
-		drawFastHLineInternal(x, y, w, color);
+		drawFastHLineInternal(x, y, w, op, src);
 	}
 }
 
 void ESP8266_SSD1322::drawFastHLineInternal(int16_t x, int16_t y, int16_t w,
-		uint16_t color) {
+		uint8_t op, uint8_t src) {
 	// Do bounds/limit checks
-	if (y < 0 || y >= HEIGHT) {
+	if (y < 0 || y >= bufHeight) {
 		return;
 	}
 
@@ -512,8 +863,8 @@ void ESP8266_SSD1322::drawFastHLineInternal(int16_t x, int16_t y, int16_t w,
 	}
 
 	// make sure we don't go off the edge of the display
-	if ((x + w) > WIDTH) {
-		w = (WIDTH - x);
+	if ((x + w) > bufWidth) {
+		w = (bufWidth - x);
 	}
 
 	// if our width is now negative, punt
@@ -521,192 +872,20 @@ void ESP8266_SSD1322::drawFastHLineInternal(int16_t x, int16_t y, int16_t w,
 		return;
 	}
 
-	// set up the pointer for  movement through the buffer
-#ifdef SSD1322_256_64_4
-
-	// adjust the buffer pointer for the current row
-	register uint8_t *pBuf = buffer;
-	pBuf += (x >> 1) + (y * (SSD1322_LCDWIDTH / 2));
-
-	register uint8_t oddmask = color;
-	register uint8_t evenmask = (color << 4);
-	register uint8_t fullmask = (color << 4) + color;
-	uint8_t byteLen = w / 2;
-
-	if (((x % 2) == 0) && ((w % 2) == 0))  // Start at even and length is even
-	{
-		while (byteLen--)
-		{
-			*pBuf++ = fullmask;
-		}
-
-		return;
-	}
-
-	if (((x % 2) == 1) && ((w % 2) == 1)) // Start at odd and length is odd
-	{
-		register uint8_t b1 = *pBuf;
-		b1 &= (x % 2) ? 0xF0 : 0x0F; // cleardown nibble to be replaced
-
-		// write our value in
-		*pBuf++ = b1 | oddmask;
-
-		while (byteLen--)
-		{
-			*pBuf++ = fullmask;
-		}
-		return;
-	}
-
-	if (((x % 2) == 0) && ((w % 2) == 1)) // Start at even and length is odd
-	{
-		while (byteLen--)
-		{
-			*pBuf++ = fullmask;
-		}
-
-		register uint8_t b1 = *pBuf;
-		b1 &= 0x0F; // cleardown nibble to be replaced
-
-		// write our value in
-		*pBuf++ = b1 | evenmask;
-		return;
-	}
-
-	if (((x % 2) == 1) && ((w % 2) == 0)) // Start at odd and length is even
-	{
-		register uint8_t b1 = *pBuf;
-		b1 &= (x % 2) ? 0xF0 : 0x0F; // cleardown nibble to be replaced
-
-		// write our value in
-		*pBuf++ = b1 | oddmask;
-
-		while (byteLen--)
-		{
-			*pBuf++ = fullmask;
-		}
-
-		b1 = *pBuf;
-		b1 &= 0x0F; // cleardown nibble to be replaced
-
-		// write our value in
-		*pBuf++ = b1 | evenmask;
-		return;
-	}
-#endif
-#ifdef SSD1322_256_64_1
-	register uint8_t *pBuf = &buffer[(x >> 3) + (y * (SSD1322_LCDWIDTH / 8))];
-	// do the first partial byte, if necessary - this requires some masking
-	register uint8_t mod = (x % 8);
-
-//Serial.println("** START ***");
-//Serial.print("mod=");
-//Serial.println(mod);
-	if (mod)
-	{
-		// mask off the high n bits we want to set
-		mod = 8-mod;
-
-//Serial.print("mod=");
-//Serial.println(mod);
-		// note - lookup table results in a nearly 10% performance improvement in fill* functions
-		// register uint8_t mask = ~(0xFF >> (mod));
-		static uint8_t premask[8] = {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F };
-		register uint8_t mask = premask[mod];
-
-		// adjust the mask if we're not going to reach the end of this byte
-		if( w < mod)
-		{
-//Serial.println("here 2");
-			mask &= (0XFF << (mod - w));
-//Serial.print("mask=");
-//Serial.println((int)mask);
-		}
-
-		switch (color)
-		{
-			case WHITE:   *pBuf |=  mask;  break;
-			case BLACK:   *pBuf &= ~mask;  break;
-			case INVERSE: *pBuf ^=  mask;  break;
-		}
-
-		// fast exit if we're done here!
-		if(w < mod)
-		{
-			return;
-		}
-
-		w -= mod;
-
-		// adjust the buffer forward
-		pBuf++;
-	}
-
-
-	// write solid bytes while we can - effectively doing 8 rows at a time
-	if (w >= 8)
-	{
-		if (color == INVERSE)
-		{          // separate copy of the code so we don't impact performance of the black/white write version with an extra comparison per loop
-		  do
-		  {
-			  *pBuf=~(*pBuf);
-
-				// adjust the buffer forward
-				pBuf++;
-
-				// adjust h & y (there's got to be a faster way for me to do this, but this should still help a fair bit for now)
-				w -= 8;
-			  } while(w >= 8);
-		}
-		else
-		{
-//Serial.println("here 1");
-			// store a local value to work with
-			register uint8_t val = (color == WHITE) ? 255 : 0;
-
-			do
-			{
-//Serial.print("w=");
-//Serial.println(w);
-				// write our value in
-				*pBuf = val;
-
-				// adjust the buffer forward
-				pBuf++;
-
-				// adjust h & y (there's got to be a faster way for me to do this, but this should still help a fair bit for now)
-				w -= 8;
-			} while(w >= 8);
-		}
-	}
-
-	// now do the final partial byte, if necessary
-	if (w)
-	{
-		mod = w % 8;
-//Serial.print("w%8=");
-//Serial.println(mod);
-		// this time we want to mask the low bits of the byte, vs the high bits we did above
-		// register uint8_t mask = (1 << mod) - 1;
-		// note - lookup table results in a nearly 10% performance improvement in fill* functions
-		static uint8_t postmask[8] = {0x00, 0x80, 0xC0, 0xE0, 0xF0, 0xF8, 0xFC, 0xFE };
-		register uint8_t mask = postmask[mod];
-		switch (color)
-		{
-			case WHITE:   *pBuf |=  mask;  break;
-			case BLACK:   *pBuf &= ~mask;  break;
-			case INVERSE: *pBuf ^=  mask;  break;
-		}
-	}
-#endif
-
+	fillSpan(ropSpanTable[op], x, y, w, src);
 }
 
 void ESP8266_SSD1322::drawFastVLine(int16_t x, int16_t y, int16_t h,
 		uint16_t color) {
+	uint8_t op, src;
+	resolveRop(color, op, src);
+	vspan(x, y, h, op, src);
+}
+
+// Vertical run in screen coordinates, the raster op already resolved
+void ESP8266_SSD1322::vspan(int16_t x, int16_t y, int16_t h, uint8_t op, uint8_t src) {
 	bool bSwap = false;
-	switch (rotation) {
+	switch (flushRotation ? 0 : rotation) {
 	case 0:
 		break;
 	case 1:
@@ -733,17 +912,17 @@ void ESP8266_SSD1322::drawFastVLine(int16_t x, int16_t y, int16_t h,
 	}
 
 	if (bSwap) {
-		drawFastHLineInternal(x, y, h, color);
+		drawFastHLineInternal(x, y, h, op, src);
 	} else {
-		drawFastVLineInternal(x, y, h, color);
+		drawFastVLineInternal(x, y, h, op, src);
 	}
 }
 
 void ESP8266_SSD1322::drawFastVLineInternal(int16_t x, int16_t __y,
-		int16_t __h, uint16_t color) {
+		int16_t __h, uint8_t op, uint8_t src) {
 
 	// do nothing if we're off the left or right side of the screen
-	if (x < 0 || x >= WIDTH) {
+	if (x < 0 || x >= bufWidth) {
 		return;
 	}
 
@@ -756,8 +935,8 @@ void ESP8266_SSD1322::drawFastVLineInternal(int16_t x, int16_t __y,
 	}
 
 	// make sure we don't go past the height of the display
-	if ((__y + __h) > HEIGHT) {
-		__h = (HEIGHT - __y);
+	if ((__y + __h) > bufHeight) {
+		__h = (bufHeight - __y);
 	}
 
 	// if our height is now negative, punt
@@ -765,866 +944,3392 @@ void ESP8266_SSD1322::drawFastVLineInternal(int16_t x, int16_t __y,
 		return;
 	}
 
-	// this display doesn't need ints for coordinates, use local byte registers for faster juggling
-	register uint8_t y = __y;
-	register uint8_t h = __h;
+	// the portrait buffer is 256 rows tall, so a full column no longer fits a byte
+	register uint16_t y = __y;
+	register uint16_t h = __h;
 
-#ifdef SSD1322_256_64_4
-	// set up the pointer for fast movement through the buffer
-	register uint8_t *pBuf = buffer;
-	// adjust the buffer pointer for the current row
-	pBuf += (x >> 1) + (y  * (SSD1322_LCDWIDTH / 2));
+	register uint8_t *pBuf = &buffer[((x * SSD1322_BITS_PER_PIXEL) >> 3) + (y * bufStride)];
+	register uint8_t shift = (x * SSD1322_BITS_PER_PIXEL) & 7;
+	register uint8_t mask = (0xFF >> shift) & ~(0xFF >> (shift + SSD1322_BITS_PER_PIXEL));
 
-	register uint8_t mask = ((x % 2) ? color : color << 4);
+	ropColumnTable[op](pBuf, src, mask, h, bufStride);
+}
 
-	while (h--)
-	{
-		register uint8_t b1 = *pBuf;
-		b1 &= (x % 2) ? 0xF0 : 0x0F; // cleardown nibble to be replaced
+// bufferLine() flags: leave out an end point already drawn by the previous segment
+#define LINE_SKIP_START 1
+#define LINE_SKIP_END 2
 
-		// write our value in
-		*pBuf = b1 | mask;
+// Coordinates beyond this could overflow the 32 bit clipping maths
+#define LINE_MAX_COORD 16383
 
-		// adjust the buffer forward to next row worth of data
-		pBuf += SSD1322_LCDWIDTH / 2;
+static inline boolean lineInRange(int16_t x0, int16_t y0, int16_t x1, int16_t y1)
+{
+	return abs(x0) <= LINE_MAX_COORD && abs(y0) <= LINE_MAX_COORD &&
+	       abs(x1) <= LINE_MAX_COORD && abs(y1) <= LINE_MAX_COORD;
+}
 
-	};
-#endif
-#ifdef SSD1322_256_64_1
-	register uint8_t *pBuf = &buffer[(x >> 3) + (y * (SSD1322_LCDWIDTH / 8))];
-	register uint8_t mod = (x % 8);
+// Bresenham line in buffer coordinates, the same pixels Adafruit_GFX::drawLine
+// picks in an unrotated buffer (per pixel rotation may break ties the other way).
+// The visible part is worked out once from the step number k of the unclipped
+// line (a parametric clip), so clipping never shifts a pixel.  Shallow lines
+// go out as horizontal spans, steep ones walk the buffer pointer and pixel mask.
+static void bufferLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint8_t op, uint8_t src, uint8_t skip)
+{
+	boolean steep = abs(y1 - y0) > abs(x1 - x0);
 
+	if (steep)
+	{
+		_swap_int16_t(x0, y0);
+		_swap_int16_t(x1, y1);
+	}
+	if (x0 > x1)
+	{
+		_swap_int16_t(x0, x1);
+		_swap_int16_t(y0, y1);
+		skip = ((skip & LINE_SKIP_START) ? LINE_SKIP_END : 0) | ((skip & LINE_SKIP_END) ? LINE_SKIP_START : 0);
+	}
+
+	// from here x is the major axis and y the minor one
+	int32_t dx = x1 - x0;
+	int32_t dy = abs(y1 - y0);
+	int8_t ystep = (y0 < y1) ? 1 : -1;
+	int32_t half = dx / 2;
+	int32_t xMax = (steep ? bufHeight : bufWidth) - 1;
+	int32_t yMax = (steep ? bufWidth : bufHeight) - 1;
+
+	// steps k that land on screen along the major axis
+	int32_t kLo = (x0 < 0) ? -x0 : 0;
+	int32_t kHi = min(dx, xMax - x0);
+
+	if (skip & LINE_SKIP_START) kLo = max(kLo, (int32_t)1);
+	if (skip & LINE_SKIP_END) kHi = min(kHi, dx - 1);
+
+	// and along the minor axis: step k has taken m = (k * dy + dx - 1 - half) / dx minor steps
+	int32_t mLo = (ystep > 0) ? -y0 : y0 - yMax;
+	int32_t mHi = (ystep > 0) ? yMax - y0 : y0;
+
+	if (mHi < 0)
+	{
+		return;
+	}
+	if (dy == 0)
+	{
+		if (mLo > 0) return;
+	}
+	else
+	{
+		if (mLo > 0) kLo = max(kLo, (mLo * dx - dx + half + dy) / dy);
+		kHi = min(kHi, (mHi * dx + half) / dy);
+	}
+	if (kLo > kHi)
+	{
+		return;
+	}
+
+	// Bresenham state at the first visible step
+	int32_t m = dx ? (kLo * dy + dx - 1 - half) / dx : 0;
+	register int16_t err = half - kLo * dy + m * dx;
+	register int16_t a = x0 + kLo;
+	register int16_t b = y0 + ystep * m;
+	register uint16_t n = kHi - kLo + 1;
+
+	if (steep)
+	{
+		// one pixel per buffer row
+		register uint16_t bit = b * SSD1322_BITS_PER_PIXEL;
+		ropLineSteepTable[op](&buffer[(bit >> 3) + a * bufStride], SSD1322_LEFT_PIXEL >> (bit & 7),
+				src, n, bufStride, err, dx, dy, ystep);
+		return;
+	}
 
-	static uint8_t postmask[8] = {0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
-	register uint8_t mask = postmask[mod];
+	// pixels sharing a row go out as one span
+	RopSpanFn kernel = ropSpanTable[op];
+	register int16_t runStart = a;
 
-	while (h--)
+	while (n--)
 	{
-		switch (color)
+		err -= dy;
+		if (err < 0)
 		{
-			case WHITE:		*pBuf |=  mask;	break;
-			case BLACK:		*pBuf &= ~mask; break;
-			case INVERSE:	*pBuf ^=  mask; break;
+			fillSpan(kernel, runStart, b, a - runStart + 1, src);
+			b += ystep;
+			err += dx;
+			runStart = a + 1;
 		}
+		a++;
+	}
+	if (a > runStart)
+	{
+		fillSpan(kernel, runStart, b, a - runStart, src);
+	}
+}
+
+void ESP8266_SSD1322::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color)
+{
+	if (!lineInRange(x0, y0, x1, y1))
+	{
+		Adafruit_GFX::drawLine(x0, y0, x1, y1, color);
+		return;
+	}
+
+	uint8_t op, src;
+	resolveRop(color, op, src);
+
+	toBuffer(x0, y0);
+	toBuffer(x1, y1);
+	bufferLine(x0, y0, x1, y1, op, src, 0);
+}
+
+// A line with a coordinate past LINE_MAX_COORD, pixel by pixel through
+// drawPixel() as Adafruit_GFX::drawLine() does, but in 32 bit maths and able
+// to leave out end points like bufferLine().
+void ESP8266_SSD1322::pixelLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, uint8_t skip)
+{
+	boolean steep = abs(y1 - y0) > abs(x1 - x0);
+	int32_t t;
 
-		// adjust the buffer forward to next row worth of data
-		pBuf += SSD1322_LCDWIDTH / 8;
+	if (steep)
+	{
+		t = x0; x0 = y0; y0 = t;
+		t = x1; x1 = y1; y1 = t;
+	}
+	if (x0 > x1)
+	{
+		t = x0; x0 = x1; x1 = t;
+		t = y0; y0 = y1; y1 = t;
+		skip = ((skip & LINE_SKIP_START) ? LINE_SKIP_END : 0) | ((skip & LINE_SKIP_END) ? LINE_SKIP_START : 0);
+	}
+
+	int32_t dx = x1 - x0;
+	int32_t dy = abs(y1 - y0);
+	int32_t err = dx / 2;
+	int8_t ystep = (y0 < y1) ? 1 : -1;
+
+	for (int32_t x = x0, y = y0; x <= x1; x++)
+	{
+		if (!((x == x0 && (skip & LINE_SKIP_START)) || (x == x1 && (skip & LINE_SKIP_END))))
+		{
+			if (steep)
+			{
+				drawPixel(y, x, color);
+			}
+			else
+			{
+				drawPixel(x, y, color);
+			}
+		}
+		err -= dy;
+		if (err < 0)
+		{
+			y += ystep;
+			err += dx;
+		}
 	}
-#endif
 }
 
 /**
- * Fill the display with the specified colour by setting
- * every pixel to the colour.
- * @param colour - fill the display with this colour.
+ * Connect n points with lines.  Shared vertices are drawn once, also when the
+ * last point repeats the first to close the shape, so SSD1322_ROP_XOR traces
+ * stay clean.
+ * @param points - the vertices, in RAM.
+ * @param n - number of points.
+ * @param color - line colour.
  */
-void ESP8266_SSD1322::fill(uint8_t colour)
+void ESP8266_SSD1322::drawPolyline(const SSD1322_Point *points, uint16_t n, uint16_t color)
 {
-    uint8_t x,y;
-
-    ssd1322_command(SSD1322_SETCOLUMNADDR);
-    ssd1322_data(MIN_SEG);
-    ssd1322_data(MAX_SEG);
+	if (n == 0)
+	{
+		return;
+	}
+	if (n == 1)
+	{
+		drawPixel(points[0].x, points[0].y, color);
+		return;
+	}
 
-    ssd1322_command(SSD1322_SETROWADDR);
-    ssd1322_data(0);
-    ssd1322_data(63);
+	boolean closed = (n > 2) && (points[0].x == points[n - 1].x) && (points[0].y == points[n - 1].y);
+	uint8_t op, src;
+	resolveRop(color, op, src);
 
-    colour = (colour & 0x0F) | (colour << 4);
+	for (uint16_t i = 0; i < n - 1; i++)
+	{
+		int16_t x0 = points[i].x;
+		int16_t y0 = points[i].y;
+		int16_t x1 = points[i + 1].x;
+		int16_t y1 = points[i + 1].y;
 
-    ssd1322_command(SSD1322_WRITERAM);
+		uint8_t skip = ((i > 0) ? LINE_SKIP_START : 0) | ((closed && i == n - 2) ? LINE_SKIP_END : 0);
 
-	for(y=0; y<64; y++)
-    {
-		for(x=0; x<64; x++)
+		if (!lineInRange(x0, y0, x1, y1))
 		{
-		    ssd1322_data(colour);
-		    ssd1322_data(colour);
+			pixelLine(x0, y0, x1, y1, color, skip);
+			continue;
 		}
-    }
-    delay(0);
-}
 
-#ifdef SSD1322_256_64_1
+		toBuffer(x0, y0);
+		toBuffer(x1, y1);
+		bufferLine(x0, y0, x1, y1, op, src, skip);
+	}
+}
 
-void ESP8266_SSD1322::fastDrawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint8_t color)
+// Span x0 .. x1 of screen row y.  Clipped to the screen here, so the shape
+// code below can hand over rows of any width.
+void ESP8266_SSD1322::rowSpan(int16_t x0, int16_t x1, int16_t y, uint8_t op, uint8_t src)
 {
-//Serial.println("-------fastDrawBitmap----------");
+	if (y < 0 || y >= _height || x1 < 0 || x0 >= _width || x1 < x0)
+	{
+		return;
+	}
+	if (x0 < 0) x0 = 0;
+	if (x1 >= _width) x1 = _width - 1;
 
-  // do nothing if we're off the left or right side of the screen
-  if ((x + w) < 0 || x >= SSD1322_LCDWIDTH)
-  {
-//cout << "all off left/right" << endl;
-    return;
-  }
+	hspan(x0, y, x1 - x0 + 1, op, src);
+}
 
-  // Do nothing if off top or bottom
-  if (y + h < 0 || y >= SSD1322_LCDHEIGHT)
-  {
-//cout << "all off top/bottom" << endl;
-    return;
-  }
+void ESP8266_SSD1322::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color)
+{
+	// clip once, the spans below are then all on screen
+	if (x < 0)
+	{
+		w += x;
+		x = 0;
+	}
+	if (y < 0)
+	{
+		h += y;
+		y = 0;
+	}
+	if (w > _width - x) w = _width - x;
+	if (h > _height - y) h = _height - y;
+	if (w <= 0 || h <= 0)
+	{
+		return;
+	}
 
-  register int8_t xDiv8 = (x / 8);
-  register int8_t wDiv8 = (w / 8);
-
-//Serial.print("xDiv8=");
-//Serial.println(xDiv8);
-
-  // calc start pos in the buffer
-  register uint8_t *pBuf = &buffer[xDiv8 + (y * (SSD1322_LCDWIDTH / 8))];
-  // Divide by 8, as 8 pixels per byte (1 bit per pixel) unless this not, then need to add 1 extra byte
-  register uint8_t wInBytes = ((w % 8) > 0) ? wDiv8 + 1 : wDiv8;
-  register uint8_t wStartByte = (xDiv8 < 0 ? abs(xDiv8) : 0);
-  register uint16_t hInRows = min(SSD1322_LCDHEIGHT - y, h);
-  register uint16_t bytePos = 0;
-  pBuf += wStartByte;  // Move start of buffer up if X < 0
-//    wInBytes -= wStartByte;
-  register int16_t mod = x % 8;
-  register uint8_t bmap = 0;
-  register uint8_t mask;
-
-//    bytePos += wStartByte;
-//Serial.print("wInBytes=");
-//Serial.println(wInBytes);
-//Serial.print("wStartByte=");
-//Serial.println(wStartByte);
-//Serial.print("mod=");
-//Serial.println(mod);
-//Serial.print("pBuf=");
-//Serial.println(pBuf - buffer);
-
-  if (x < 0) // x is less than zero
-  {
-//Serial.print("wInBytes=");
-//Serial.println(wInBytes);
-//Serial.print("wStartByte=");
-//Serial.println(wStartByte);
-//Serial.print("mod=");
-//Serial.println(mod);
-//Serial.print("pBuf=");
-//Serial.println(pBuf - buffer);
-
-    bytePos += wStartByte;
-
-    mod = abs(mod);
-//Serial.print("mod now=");
-//Serial.println(mod);
-    // loop the height
-    for (int lh = 0; lh < hInRows; lh++)
-    {
-      register uint8_t shftedOut = 0;
+	uint8_t op, src;
+	resolveRop(color, op, src);
 
-      // loop the width
-      for (int lw = 0; lw < wInBytes; lw++)
-      {
-//Serial.print("lw=");
-//Serial.println(lw);
-
-	if (lw >= wStartByte)
-	{
-//Serial.println("lw >= wStartByte");
-//Serial.print("pBuf=");
-//Serial.println(pBuf - buffer);
-//Serial.print("bytePos=");
-//Serial.println(bytePos);
-
-	  // Get byte from bitmap to display
-	  bmap = pgm_read_byte((uint8_t *)bitmap + bytePos++);
-	  // Shift the byte to display at correct x position.
-	  mask = bmap << mod;
-
-	  if (lw != (wInBytes - 1))
-	  {
-//Serial.println("dont do last");
-	    bmap = pgm_read_byte((uint8_t *)bitmap + bytePos); // Get next byte in image
-	    shftedOut = bmap >> (8-mod);
-	    // Move in the bytes from the shifted out of previous
-	    mask |= shftedOut;
-	  }
-
-	// Display this image byte
-	  switch (color)
-	  {
-	    case WHITE:    *pBuf++ |=  mask; break;
-	    case BLACK:    *pBuf++ &= ~mask; break;
-	    case INVERSE:  *pBuf++ ^=  mask; break;
-	  }
-	}
-      }//for (int lw = 0; lw < wInBytes; lw++)
-//Serial.println("Row done");
-
-      pBuf += (SSD1322_LCDWIDTH / 8) - wInBytes + wStartByte; // Move buffer position to next row
-
-      bytePos += wStartByte;
-    }//for (int lh = 0; lh < hInRows; lh++)
-  }
-  else
-  {
-    if (mod != 0)
-    {
-//Serial.print("---- GREATER THAN ZERO ----");
-      // loop the height
-      for (int lh = 0; lh < hInRows; lh++)
-      {
-	bool rowTerminated = false;
-	register uint8_t shftedOut = 0;
-
-	// loop the width
-	for (int lw = 0; lw < wInBytes; lw++)
-	{
-//Serial.print("pBuf=");
-//Serial.println(pBuf - buffer);
-//Serial.print("bytePos=");
-//Serial.println(bytePos);
-
-	  // Get byte from bitmap to display
-	  bmap = pgm_read_byte((uint8_t *)bitmap + bytePos++);
-	  // Shift the byte to display at correct x position.
-	  mask = bmap >> mod;
-	  // Move in the bytes from the shifted out of previous
-	  mask |= shftedOut;
-
-//Serial.print("bmap=");
-//Serial.println(bmap);
-//Serial.print("mask=");
-//Serial.println(mask);
-	  // Display this image byte
-	  switch (color)
-	  {
-	    case WHITE:    *pBuf++ |=  mask; break;
-	    case BLACK:    *pBuf++ &= ~mask; break;
-	    case INVERSE:  *pBuf++ ^=  mask; break;
-	  }
-
-	  // Somehow look at pBuf and see if this is now gone off the screen
-	  // to the right to start with.
-	  if ((pBuf - buffer) % (SSD1322_LCDWIDTH / 8) == 0)
-	  {
-//Serial.print("rowend ");
-//Serial.println(pBuf - buffer);
-	    pBuf += wInBytes - (lw + 1); // Move buffer up
-	    bytePos += wInBytes - (lw + 1);
-	    rowTerminated = true;
-	    break;
-	  }
-
-	  // Now get the part of the bitmap that was shifted
-	  // off the right and needs to be masked into the
-	  // next byte over.
-	  shftedOut = bmap << (8-mod);
-	}//for (int lw = 0; lw < wInBytes; lw++)
-//Serial.println("Row done");
-
-	// We need to handle the shifted bytes into the byte beyond
-	// the width of the bitmap.
-
-	if (!rowTerminated)
-	{
-//Serial.print("pBuf=");
-//Serial.println(pBuf - buffer);
-//Serial.print("bytePos=");
-//Serial.println(bytePos);
-
-	  // If need to write this to the next byte of the display
-	  // Display this image byte
-	  switch (color)
-	  {
-	    case WHITE:    *pBuf++ |=  shftedOut; break;
-	    case BLACK:    *pBuf++ &= ~shftedOut; break;
-	    case INVERSE:  *pBuf++ ^=  shftedOut; break;
-	  }
-
-	  pBuf += (SSD1322_LCDWIDTH / 8) - (wInBytes + 1); // Move buffer position to next row
+	// walk the direction that runs along buffer rows
+	if ((flushRotation ? 0 : rotation) & 1)
+	{
+		for (int16_t i = 0; i < w; i++)
+		{
+			vspan(x + i, y, h, op, src);
+		}
 	}
 	else
 	{
-	  pBuf += (SSD1322_LCDWIDTH / 8) - wInBytes; // Move buffer position to next row
-	}//if (!rowTerminated)
+		for (int16_t i = 0; i < h; i++)
+		{
+			hspan(x, y + i, w, op, src);
+		}
+	}
+}
 
-	bytePos += wStartByte;
-      }//for (int lh = 0; lh < hInRows; lh++)
-    }
-    else //if (mod != 0)
-    {
-//Serial.println("---- MOD == 0 ----");
-      // loop the height
-      for (int lh = 0; lh < hInRows; lh++)
-      {
-	// loop the width
-	for (int lw = 0; lw < wInBytes; lw++)
-	{
-//Serial.print("lw=");
-//Serial.println(lw);
-// Don't draw data off the screen
-	  if (lw >= wStartByte)
-	  {
-//Serial.println("lw >= wStartByte");
-//
-//Serial.print("pBuf=");
-//Serial.println(pBuf - buffer);
-//Serial.print("bytePos=");
-//Serial.println(bytePos);
-
-	    *pBuf++ = pgm_read_byte((uint8_t *)bitmap + bytePos++);
-	  }
-	  else
-	  {
-	    bytePos++;  // Move up the bitmap
-	  }
-
-	  if ((pBuf - buffer) % (SSD1322_LCDWIDTH / 8) == 0)
-	  {
-//Serial.print("rowend=");
-//Serial.println(pBuf - buffer);
-	    pBuf += wInBytes - (lw + 1); // Move buffer up
-	    bytePos += wInBytes - (lw + 1);
-	    break;
-	  }//if ((pBuf - buffer) % (SSD1322_LCDWIDTH / 8) == 0)
-	}//for (int lw = 0; lw < wInBytes; lw++)
-
-//Serial.println("Row done");
-	pBuf += (SSD1322_LCDWIDTH / 8) - wInBytes + wStartByte; // Move buffer position to next row
-//	bytePos += wStartByte;
-      }//for (int lh = 0; lh < hInRows; lh++)
-    }//if (mod != 0)
-  }//if (x < 0)
+// Half width of row dy of a filled circle, from the half width hw of row
+// dy - 1 (start with hw = r).  rr is r * r.  These are exactly the rows the
+// midpoint circle of Adafruit_GFX covers: above the diagonal the midpoint test
+// runs on x, below it on y.
+static inline int16_t circleHalfWidth(int32_t rr, int16_t dy, int16_t hw)
+{
+	while (hw > 0)
+	{
+		int32_t d = (hw >= dy) ? (int32_t)hw * (hw - 1) + (int32_t)dy * dy
+		                       : (int32_t)hw * hw + (int32_t)dy * (dy - 1);
+		if (d < rr)
+		{
+			break;
+		}
+		hw--;
+	}
+	return hw;
 }
 
-#endif
+/**
+ * Circle outline, one or two spans per row.  Every pixel is written once,
+ * so SSD1322_ROP_XOR draws and erases cleanly.
+ */
+void ESP8266_SSD1322::drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
+{
+	if (r < 0)
+	{
+		return;
+	}
 
-#ifdef SSD1322_256_64_4
-/***************************************************************************************
-** Function name:           fastDrawBitmap
-** Descriptions:            draw a bitmap fast.  Right now limits are bitmap must be mutiple
-** of 8 bits in width.
-***************************************************************************************/
-void ESP8266_SSD1322::fastDrawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint8_t color)
+	uint8_t op, src;
+	resolveRop(color, op, src);
+
+	int32_t rr = (int32_t)r * r;
+	int16_t hw = r;
+
+	for (int16_t dy = 0; dy <= r; dy++)
+	{
+		int16_t next = (dy < r) ? circleHalfWidth(rr, dy + 1, hw) : -1;
+		// the outline of this row runs from a to hw either side of the centre
+		int16_t a = min((int16_t)(next + 1), hw);
+
+		for (int8_t side = (dy ? -1 : 1); side <= 1; side += 2)
+		{
+			int16_t y = y0 + side * dy;
+			if (a == 0)
+			{
+				rowSpan(x0 - hw, x0 + hw, y, op, src);
+			}
+			else
+			{
+				rowSpan(x0 - hw, x0 - a, y, op, src);
+				rowSpan(x0 + a, x0 + hw, y, op, src);
+			}
+		}
+		hw = next;
+	}
+}
+
+void ESP8266_SSD1322::fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color)
 {
-  // do nothing if we're off the left or right side of the screen
-  if (x < 0 || x >= WIDTH)
-  {
-	  return;
-  }
+	if (r < 0)
+	{
+		return;
+	}
 
-  // TODO - NEEDS SOME WORK TO HANDLE XPOS that is not multiple of 8 bits
-  // calc start pos in the buffer
-  register uint8_t *pBuf = &buffer[(x >> 1) + (y * (SSD1322_LCDWIDTH / 2))];
-  register uint8_t wInBytes = w >> 1; // Divide by 2, as 2 pixels per byte (4 bits per pixel)
-  uint16_t bitPos = 0;
+	uint8_t op, src;
+	resolveRop(color, op, src);
 
-  // loop the height
-  for (int lh = 0; lh < h; lh++)
-  {
-    // loop the width
-    for (int lw = 0; lw < wInBytes; lw++)
-    {
-      *pBuf++ = pgm_read_byte((uint8_t *)bitmap + bitPos++);
-    }
+	int32_t rr = (int32_t)r * r;
+	int16_t hw = r;
 
-    pBuf += (SSD1322_LCDWIDTH / 2) - wInBytes; // Move buffer position to next row
-  }
+	rowSpan(x0 - r, x0 + r, y0, op, src);
+	for (int16_t dy = 1; dy <= r; dy++)
+	{
+		if (y0 - dy < 0 && y0 + dy >= _height)
+		{
+			break; // the rest is off screen
+		}
+		hw = circleHalfWidth(rr, dy, hw);
+		rowSpan(x0 - hw, x0 + hw, y0 - dy, op, src);
+		rowSpan(x0 - hw, x0 + hw, y0 + dy, op, src);
+	}
 }
-#endif
 
-/***************************************************************************************
-** Function name:           drawUnicode
-** Descriptions:            draw a unicode
-***************************************************************************************/
-int ESP8266_SSD1322::drawUnicode(unsigned int uniCode, int x, int y, int size)
+/**
+ * Filled rectangle with rounded corners, one span per row.
+ * @param r - corner radius, limited to half the shorter side.
+ */
+void ESP8266_SSD1322::fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color)
 {
-//Serial.println("drawUnicode:E");
-   if (size) uniCode -= 32;
-
-   uint8_t width = 0;
-   uint8_t height = 0;
-   uint32_t flash_address = 0;
-   int8_t gap = 0;
-
-//   if (size == 1) {
-//     flash_address = pgm_read_word(&chrtbl_f8[uniCode]);
-//     width = pgm_read_byte((uint8_t *)widtbl_f8+uniCode);
-//     height = chr_hgt_f8;
-//     gap = 1;
-//   }
-
-// in calls to pgm_read_dword(), compiler will warn about strict-aliasing,
-// 'cause chrtbl_* are uint8_t[] instead of uint32_t[]
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+	if (w <= 0 || h <= 0)
+	{
+		return;
+	}
+	if (r > min(w, h) / 2) r = min(w, h) / 2;
+	if (r < 0) r = 0;
 
-#ifdef LOAD_FONT2
-   if (size == 2) {
-	 flash_address = pgm_read_dword(&chrtbl_f16[uniCode]);
-     width = pgm_read_byte((uint8_t *)widtbl_f16+uniCode);
-     height = chr_hgt_f16;
-     gap = 1;
-   }
-#endif
-//   if (size == 3) {
-//     flash_address = pgm_read_word(&chrtbl_f24[uniCode]);
-//     width = pgm_read_byte((uint8_t *)widtbl_f24+uniCode);
-//     height = chr_hgt_f24;
-//     gap = 0;
-//   }
-#ifdef LOAD_FONT4
-   if (size == 4) {
-     flash_address = pgm_read_dword(&chrtbl_f32[uniCode]);
-     width = pgm_read_byte((uint8_t *)widtbl_f32+uniCode);
-     height = chr_hgt_f32;
-     gap = -3;
-   }
-#endif
-//   if (size == 5) {
-//     flash_address = pgm_read_word(&chrtbl_f48[uniCode]);
-//     width = pgm_read_byte((uint8_t *)widtbl_f48+uniCode);
-//     height = chr_hgt_f48;
-//     gap = -3;
-//   }
-#ifdef LOAD_FONT6
-   if (size == 6) {
-     flash_address = pgm_read_dword(&chrtbl_f64[uniCode]);
-     width = pgm_read_byte((uint8_t *)widtbl_f64+uniCode);
-     height = chr_hgt_f64;
-     gap = -3;
-   }
-#endif
-#ifdef LOAD_FONT7
-   if (size == 7) {
-     flash_address = pgm_read_dword(&chrtbl_f7s[uniCode]);
-     width = pgm_read_byte((uint8_t *)widtbl_f7s+uniCode);
-     height = chr_hgt_f7s;
-     gap = 2;
-   }
-#endif
-#ifdef LOAD_FONT8
-   if (size == 8) {
-     flash_address = pgm_read_dword(&chrtbl_F10[uniCode]);
-     width = pgm_read_byte((uint8_t *)widtbl_F10+uniCode);
-     height = chr_hgt_F10;
-     gap = gap_F10;
-   }
-#endif
-#pragma GCC diagnostic pop
+	uint8_t op, src;
+	resolveRop(color, op, src);
 
-   if (!flash_address) {
-	   return 0;
-   }
+	// corner centres
+	int16_t xl = x + r;
+	int16_t xr = x + w - r - 1;
+	int16_t yt = y + r;
+	int16_t yb = y + h - r - 1;
+	int32_t rr = (int32_t)r * r;
+	int16_t hw = r;
+
+	for (int16_t row = yt; row <= yb; row++)
+	{
+		rowSpan(x, x + w - 1, row, op, src);
+	}
+	for (int16_t dy = 1; dy <= r; dy++)
+	{
+		hw = circleHalfWidth(rr, dy, hw);
+		rowSpan(xl - hw, xr + hw, yt - dy, op, src);
+		rowSpan(xl - hw, xr + hw, yb + dy, op, src);
+	}
+}
+
+// A triangle edge: x = base + s / den for s = s0, s0 + d, s0 + 2d ... one row
+// at a time.  s keeps the sign of d, so keeping quotient and remainder apart
+// reproduces C's truncating division without dividing per row.
+typedef struct {
+	int16_t x;
+	int32_t rem, dq, dr, den;
+} EdgeStep;
+
+static inline void edgeStart(EdgeStep &e, int16_t base, int32_t s0, int32_t d, int32_t den)
+{
+	e.x = base + s0 / den;
+	e.rem = s0 % den;
+	e.dq = d / den;
+	e.dr = d % den;
+	e.den = den;
+}
+
+static inline void edgeNext(EdgeStep &e)
+{
+	e.x += e.dq;
+	e.rem += e.dr;
+	if (e.rem >= e.den)
+	{
+		e.x++;
+		e.rem -= e.den;
+	}
+	else if (e.rem <= -e.den)
+	{
+		e.x--;
+		e.rem += e.den;
+	}
+}
+
+/**
+ * Filled triangle, one span per row, the same pixels as Adafruit_GFX.
+ * Rows above or below the screen are skipped without walking the edges.
+ */
+void ESP8266_SSD1322::fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color)
+{
+	// sort by y, y0 <= y1 <= y2
+	if (y0 > y1)
+	{
+		_swap_int16_t(y0, y1);
+		_swap_int16_t(x0, x1);
+	}
+	if (y1 > y2)
+	{
+		_swap_int16_t(y2, y1);
+		_swap_int16_t(x2, x1);
+	}
+	if (y0 > y1)
+	{
+		_swap_int16_t(y0, y1);
+		_swap_int16_t(x0, x1);
+	}
+
+	uint8_t op, src;
+	resolveRop(color, op, src);
+
+	if (y0 == y2)
+	{
+		// all on one row
+		rowSpan(min(x0, min(x1, x2)), max(x0, max(x1, x2)), y0, op, src);
+		return;
+	}
 
-	int w = (width+7)/8;
-	register int pX      = 0;
-	register int pY      = y;
-	byte line = 0;
+	int32_t dx01 = x1 - x0, dy01 = y1 - y0;
+	int32_t dx02 = x2 - x0, dy02 = y2 - y0;
+	int32_t dx12 = x2 - x1, dy12 = y2 - y1;
+	EdgeStep a, b;
 
-	for(register int i=0; i<height; i++)
+	// upper part down to y1, or y1 - 1 when the lower part is there to draw
+	// that row: edges 0-1 and 0-2
+	int16_t last = (y1 == y2) ? y1 : y1 - 1;
+	int16_t y = max(y0, (int16_t)0);
+	int16_t end = min(last, (int16_t)(_height - 1));
+
+	if (y <= end)
 	{
-	  if (textcolor != textbgcolor)
-	  {
-		if (textsize == 1)
+		edgeStart(a, x0, dx01 * (y - y0), dx01, dy01);
+		edgeStart(b, x0, dx02 * (y - y0), dx02, dy02);
+		for (; y <= end; y++)
 		{
-			drawFastHLine(x, pY, width+gap, textbgcolor);
+			rowSpan(min(a.x, b.x), max(a.x, b.x), y, op, src);
+			edgeNext(a);
+			edgeNext(b);
 		}
-		else
+	}
+
+	// lower part: edges 1-2 and 0-2
+	y = max((int16_t)(last + 1), (int16_t)0);
+	end = min(y2, (int16_t)(_height - 1));
+
+	if (y <= end)
+	{
+		edgeStart(a, x1, dx12 * (y - y1), dx12, dy12);
+		edgeStart(b, x0, dx02 * (y - y0), dx02, dy02);
+		for (; y <= end; y++)
 		{
-			fillRect(x, pY, (width+gap)*textsize, textsize, textbgcolor);
-		}
-	  }
-	  for (register int k = 0;k < w; k++)
-	  {
-		line = pgm_read_byte((uint8_t *)flash_address+w*i+k);
-		if(line)
-		{
-		  if (textsize==1){
-			pX = x + k*8;
-//Serial.print("pX=");
-//Serial.println(pX);
-			if(line & 0x80) drawPixel(pX, pY, textcolor);
-			if(line & 0x40) drawPixel(pX+1, pY, textcolor);
-			if(line & 0x20) drawPixel(pX+2, pY, textcolor);
-			if(line & 0x10) drawPixel(pX+3, pY, textcolor);
-			if(line & 0x8) drawPixel(pX+4, pY, textcolor);
-			if(line & 0x4) drawPixel(pX+5, pY, textcolor);
-			if(line & 0x2) drawPixel(pX+6, pY, textcolor);
-			if(line & 0x1) drawPixel(pX+7, pY, textcolor);
-		  }
-		   else {
-			pX = x + k*8*textsize;
-			if(line & 0x80) fillRect(pX, pY, textsize, textsize, textcolor);
-			if(line & 0x40) fillRect(pX+textsize, pY, textsize, textsize, textcolor);
-			if(line & 0x20) fillRect(pX+2*textsize, pY, textsize, textsize, textcolor);
-			if(line & 0x10) fillRect(pX+3*textsize, pY, textsize, textsize, textcolor);
-			if(line & 0x8) fillRect(pX+4*textsize, pY, textsize, textsize, textcolor);
-			if(line & 0x4) fillRect(pX+5*textsize, pY, textsize, textsize, textcolor);
-			if(line & 0x2) fillRect(pX+6*textsize, pY, textsize, textsize, textcolor);
-			if(line & 0x1) fillRect(pX+7*textsize, pY, textsize, textsize, textcolor);
-		  }
-		}
-	  }
-	  pY+=textsize;
+			rowSpan(min(a.x, b.x), max(a.x, b.x), y, op, src);
+			edgeNext(a);
+			edgeNext(b);
+		}
+	}
+}
+
+// fillPolygon() edge, kept with the top end first
+typedef struct {
+	int16_t yTop, yEnd;	// covers rows yTop .. yEnd - 1
+	int16_t xTop;
+	int8_t dir;			// winding, +1 when the polygon runs down this edge
+	int32_t dx, dy;
+	int32_t x, rem;		// crossing of the current row: x + rem / dy, 0 <= rem < dy
+	int32_t dq, dr;		// step per row, split the same way
+} PolyEdge;
+
+static PolyEdge polyEdges[SSD1322_POLY_MAX_EDGES];
+static uint8_t polyActive[SSD1322_POLY_MAX_EDGES];
+
+// Division rounding down, also for negative numerators (den > 0)
+static inline int32_t floorDiv(int64_t num, int32_t den)
+{
+	int64_t q = num / den;
+	if ((num % den) < 0) q--;
+	return (int32_t)q;
+}
+
+// Set up the crossing with row y, the only division an edge needs
+static void polyEdgeStart(PolyEdge &e, int16_t y)
+{
+	int64_t s = (int64_t)e.dx * (y - e.yTop);
+	e.x = e.xTop + floorDiv(s, e.dy);
+	e.rem = (int32_t)(s - (int64_t)(e.x - e.xTop) * e.dy);
+}
+
+// First pixel whose centre lies on or right of the crossing
+static inline int32_t polyEdgeCeil(const PolyEdge &e)
+{
+	return e.x + (e.rem > 0);
+}
+
+/**
+ * Fill a polygon, concave and self intersecting ones included.  The points
+ * are pixel centres and the closing edge from the last point back to the
+ * first is implied.  A pixel is filled when its centre is inside, and
+ * centres exactly on a left or top edge count as inside, so polygons sharing
+ * an edge never overlap and every pixel is written once.
+ * @param points - the vertices, in RAM.
+ * @param n - number of points.
+ * @param color - fill colour.
+ * @param rule - SSD1322_FILL_EVENODD or SSD1322_FILL_NONZERO.
+ * @return false if the polygon has more than SSD1322_POLY_MAX_EDGES edges
+ * that are not horizontal, nothing is drawn then.
+ */
+boolean ESP8266_SSD1322::fillPolygon(const SSD1322_Point *points, uint16_t n, uint16_t color, uint8_t rule)
+{
+	uint8_t edges = 0;
+	int16_t yMin = 32767, yMax = -32768;
+
+	// edge table, sorted by top row
+	for (uint16_t i = 0; i < n; i++)
+	{
+		const SSD1322_Point &a = points[i];
+		const SSD1322_Point &b = points[(i + 1 < n) ? i + 1 : 0];
+
+		if (a.y == b.y)
+		{
+			continue; // horizontal edges never cross a row centre
+		}
+		if (edges == SSD1322_POLY_MAX_EDGES)
+		{
+			return false;
+		}
+
+		PolyEdge e;
+		e.dir = (a.y < b.y) ? 1 : -1;
+		const SSD1322_Point &top = (e.dir > 0) ? a : b;
+		const SSD1322_Point &bottom = (e.dir > 0) ? b : a;
+		e.yTop = top.y;
+		e.yEnd = bottom.y;
+		e.xTop = top.x;
+		e.dx = (int32_t)bottom.x - top.x;
+		e.dy = (int32_t)bottom.y - top.y;
+		e.dq = floorDiv(e.dx, e.dy);
+		e.dr = e.dx - e.dq * e.dy;
+
+		uint8_t j = edges++;
+		for (; j > 0 && polyEdges[j - 1].yTop > e.yTop; j--)
+		{
+			polyEdges[j] = polyEdges[j - 1];
+		}
+		polyEdges[j] = e;
+
+		yMin = min(yMin, e.yTop);
+		yMax = max(yMax, e.yEnd);
+	}
+
+	int16_t y = max(yMin, (int16_t)0);
+	int16_t yStop = min(yMax, _height);
+	if (y >= yStop)
+	{
+		return true;
+	}
+
+	uint8_t op, src;
+	resolveRop(color, op, src);
+
+	uint8_t next = 0;	// first edge of the table not yet active
+	uint8_t active = 0;
+
+	for (; y < yStop; y++)
+	{
+		// retire edges ending above this row, take in the ones starting on it
+		uint8_t kept = 0;
+		for (uint8_t i = 0; i < active; i++)
+		{
+			if (polyEdges[polyActive[i]].yEnd > y)
+			{
+				polyActive[kept++] = polyActive[i];
+			}
+		}
+		active = kept;
+		for (; next < edges && polyEdges[next].yTop <= y; next++)
+		{
+			if (polyEdges[next].yEnd > y)
+			{
+				polyEdgeStart(polyEdges[next], y);
+				polyActive[active++] = next;
+			}
+		}
+
+		// order by crossing, the list is mostly sorted from the row before
+		for (uint8_t i = 1; i < active; i++)
+		{
+			uint8_t e = polyActive[i];
+			int32_t x = polyEdgeCeil(polyEdges[e]);
+			uint8_t j = i;
+			for (; j > 0 && polyEdgeCeil(polyEdges[polyActive[j - 1]]) > x; j--)
+			{
+				polyActive[j] = polyActive[j - 1];
+			}
+			polyActive[j] = e;
+		}
+
+		// one span from where the rule turns inside to where it turns outside
+		int16_t winding = 0;
+		int32_t start = 0;
+		for (uint8_t i = 0; i < active; i++)
+		{
+			PolyEdge &e = polyEdges[polyActive[i]];
+			boolean wasInside = (winding != 0);
+
+			if (rule == SSD1322_FILL_NONZERO)
+			{
+				winding += e.dir;
+			}
+			else
+			{
+				winding ^= 1;
+			}
+
+			if (!wasInside && winding)
+			{
+				start = polyEdgeCeil(e);
+			}
+			else if (wasInside && !winding)
+			{
+				rowSpan(start, polyEdgeCeil(e) - 1, y, op, src);
+			}
+
+			// on to the next row
+			e.x += e.dq;
+			e.rem += e.dr;
+			if (e.rem >= e.dy)
+			{
+				e.x++;
+				e.rem -= e.dy;
+			}
+		}
+	}
+
+	return true;
+}
+
+// The buffer pixels under screen rectangle r, corners inclusive and clipped.
+// false when none are.
+boolean ESP8266_SSD1322::bufferRect(const SSD1322_Rect &r, int16_t &x0, int16_t &y0, int16_t &x1, int16_t &y1)
+{
+	if (r.w <= 0 || r.h <= 0)
+	{
+		return false;
+	}
+
+	int16_t ax = r.x, ay = r.y;
+	int16_t bx = r.x + r.w - 1, by = r.y + r.h - 1;
+	toBuffer(ax, ay);
+	toBuffer(bx, by);
+
+	x0 = max(min(ax, bx), (int16_t)0);
+	y0 = max(min(ay, by), (int16_t)0);
+	x1 = min(max(ax, bx), (int16_t)(bufWidth - 1));
+	y1 = min(max(ay, by), (int16_t)(bufHeight - 1));
+	return (x0 <= x1) && (y0 <= y1);
+}
+
+/**
+ * Bytes saveRect() may need for a w x h rectangle, in any rotation.
+ */
+uint16_t ESP8266_SSD1322::saveSize(int16_t w, int16_t h)
+{
+	uint16_t a = (((w * SSD1322_BITS_PER_PIXEL + 7) >> 3) + 1) * h;
+	uint16_t b = (((h * SSD1322_BITS_PER_PIXEL + 7) >> 3) + 1) * w;
+	return max(a, b);
+}
+
+/**
+ * Copy the buffer under a screen rectangle, whole bytes, to dst.  Restore it
+ * with restoreRect() on the same rectangle and rotation.
+ * @return bytes written, at most saveSize(r.w, r.h).
+ */
+uint16_t ESP8266_SSD1322::saveRect(const SSD1322_Rect &r, uint8_t *dst)
+{
+	int16_t x0, y0, x1, y1;
+	if (!bufferRect(r, x0, y0, x1, y1))
+	{
+		return 0;
+	}
+
+	uint16_t b0 = (x0 * SSD1322_BITS_PER_PIXEL) >> 3;
+	uint16_t n = ((x1 * SSD1322_BITS_PER_PIXEL) >> 3) - b0 + 1;
+	register const uint8_t *pBuf = &buffer[b0 + y0 * bufStride];
+
+	for (int16_t y = y0; y <= y1; y++)
+	{
+		memcpy(dst, pBuf, n);
+		dst += n;
+		pBuf += bufStride;
+	}
+	return n * (y1 - y0 + 1);
+}
+
+/**
+ * Put back what saveRect() took.  Only the pixels of the rectangle change,
+ * not the rest of the bytes at its left and right edges.
+ */
+void ESP8266_SSD1322::restoreRect(const SSD1322_Rect &r, const uint8_t *src)
+{
+	int16_t x0, y0, x1, y1;
+	if (!bufferRect(r, x0, y0, x1, y1))
+	{
+		return;
+	}
+
+	uint16_t bit0 = x0 * SSD1322_BITS_PER_PIXEL;
+	uint16_t bit1 = (x1 + 1) * SSD1322_BITS_PER_PIXEL;
+	uint16_t b0 = bit0 >> 3;
+	uint16_t n = ((bit1 - 1) >> 3) - b0 + 1;
+	uint8_t firstMask = 0xFF >> (bit0 & 7);
+	uint8_t lastMask = (bit1 & 7) ? ~(0xFF >> (bit1 & 7)) : 0xFF;
+	register uint8_t *pBuf = &buffer[b0 + y0 * bufStride];
+
+	if (n == 1)
+	{
+		firstMask &= lastMask;
+	}
+
+	for (int16_t y = y0; y <= y1; y++)
+	{
+		pBuf[0] = ropByte<SSD1322_ROP_COPY>(pBuf[0], src[0], firstMask);
+		if (n > 1)
+		{
+			memcpy(pBuf + 1, src + 1, n - 2);
+			pBuf[n - 1] = ropByte<SSD1322_ROP_COPY>(pBuf[n - 1], src[n - 1], lastMask);
+		}
+		src += n;
+		pBuf += bufStride;
+	}
+}
+
+/**
+ * Fill the display with the specified colour by setting
+ * every pixel to the colour.
+ * @param colour - fill the display with this colour.
+ */
+void ESP8266_SSD1322::fill(uint8_t colour)
+{
+    uint8_t x,y;
+
+    ssd1322_command(SSD1322_SETCOLUMNADDR);
+    ssd1322_data(MIN_SEG);
+    ssd1322_data(MAX_SEG);
+
+    ssd1322_command(SSD1322_SETROWADDR);
+    ssd1322_data(0);
+    ssd1322_data(63);
+
+    colour = (colour & 0x0F) | (colour << 4);
+
+    ssd1322_command(SSD1322_WRITERAM);
+
+	for(y=0; y<64; y++)
+    {
+		for(x=0; x<64; x++)
+		{
+		    ssd1322_data(colour);
+		    ssd1322_data(colour);
+		}
+    }
+    delay(0);
+}
+
+// Source pixel mask of a byte for SSD1322_BLIT_MASKED: the pixels that are not 0
+static inline uint8_t setPixels(uint8_t s)
+{
+#ifdef SSD1322_256_64_4
+  uint8_t t = s | (s >> 1);
+  t |= t >> 2;
+  return (t & 0x11) * 0x0F;
+#else
+  return s;
+#endif
+}
+
+// Row kernel modes besides the public SSD1322_BLIT_MASKED / SSD1322_BLIT_OPAQUE:
+// the bitmap's own pixels where a second line of masks allows (drawBitmap4() key)
+#define BLIT_KEYED 2
+
+template <uint8_t OP, uint8_t MODE>
+static inline uint8_t blitByte(uint8_t dst, uint8_t s, uint8_t mask, uint8_t src)
+{
+  if (MODE == SSD1322_BLIT_MASKED)
+  {
+    return ropByte<OP>(dst, src, setPixels(s) & mask);
+  }
+  return ropByte<OP>(dst, s, mask);
+}
+
+// One destination row of n bytes (n >= 1).  line holds the source bits with
+// the first wanted bit at bit sh of line[0] (MSB first), so every output byte
+// is a shift of two neighbouring source bytes.  BLIT_KEYED shifts keyLine,
+// laid out the same way, alongside for the pixel masks.
+template <uint8_t OP, uint8_t MODE>
+static void blitRow(uint8_t *pBuf, const uint8_t *line, const uint8_t *keyLine, uint8_t sh, uint16_t n,
+                    uint8_t firstMask, uint8_t lastMask, uint8_t src)
+{
+  register uint16_t acc = *line++;
+  register uint16_t keys = 0xFFFF;
+
+#define BLIT_NEXT() \
+  acc = (acc << 8) | *line++; \
+  if (MODE == BLIT_KEYED) keys = (keys << 8) | *keyLine++;
+#define BLIT_MASK(edge) ((uint8_t)(keys >> (8 - sh)) & (edge))
+
+  if (MODE == BLIT_KEYED) keys = *keyLine++;
+
+  BLIT_NEXT();
+  if (n == 1)
+  {
+    *pBuf = blitByte<OP, MODE>(*pBuf, acc >> (8 - sh), BLIT_MASK(firstMask & lastMask), src);
+    return;
+  }
+  *pBuf = blitByte<OP, MODE>(*pBuf, acc >> (8 - sh), BLIT_MASK(firstMask), src);
+  pBuf++;
+
+  for (n -= 2; n; n--)
+  {
+    BLIT_NEXT();
+    *pBuf = blitByte<OP, MODE>(*pBuf, acc >> (8 - sh), BLIT_MASK(0xFF), src);
+    pBuf++;
+  }
+
+  BLIT_NEXT();
+  *pBuf = blitByte<OP, MODE>(*pBuf, acc >> (8 - sh), BLIT_MASK(lastMask), src);
+
+#undef BLIT_NEXT
+#undef BLIT_MASK
+}
+
+typedef void (*BlitRowFn)(uint8_t *pBuf, const uint8_t *line, const uint8_t *keyLine, uint8_t sh, uint16_t n,
+                          uint8_t firstMask, uint8_t lastMask, uint8_t src);
+
+#define BLIT_ROW_KERNELS(MODE) \
+  blitRow<SSD1322_ROP_COPY, MODE>, blitRow<SSD1322_ROP_COPY, MODE>, blitRow<SSD1322_ROP_SET, MODE>, \
+  blitRow<SSD1322_ROP_CLEAR, MODE>, blitRow<SSD1322_ROP_XOR, MODE>, blitRow<SSD1322_ROP_AND, MODE>, \
+  blitRow<SSD1322_ROP_OR, MODE>, blitRow<SSD1322_ROP_MAX, MODE>, blitRow<SSD1322_ROP_MIN, MODE>, \
+  blitRow<SSD1322_ROP_ADDS, MODE>
+
+#ifdef SSD1322_256_64_4
+static const BlitRowFn blitRowTable[3][SSD1322_ROP_ADDS + 1] = {
+  { BLIT_ROW_KERNELS(SSD1322_BLIT_MASKED) },
+  { BLIT_ROW_KERNELS(SSD1322_BLIT_OPAQUE) },
+  { BLIT_ROW_KERNELS(BLIT_KEYED) }
+};
+#else
+static const BlitRowFn blitRowTable[2][SSD1322_ROP_ADDS + 1] = {
+  { BLIT_ROW_KERNELS(SSD1322_BLIT_MASKED) },
+  { BLIT_ROW_KERNELS(SSD1322_BLIT_OPAQUE) }
+};
+#endif
+
+// A clipped source row, with a zero byte either side for the shifts.  The
+// extra bytes leave room for a mono row expanded from a whole first byte.
+static uint8_t blitLine[SSD1322_LCDWIDTH * SSD1322_BITS_PER_PIXEL / 8 + 8];
+
+// Where the rows of a clipped blit land
+typedef struct {
+  uint8_t *pBuf;	// first byte of the first row
+  uint16_t bytes;	// bytes per row
+  uint8_t firstMask, lastMask;
+  uint8_t bit;		// bit of the first pixel in its byte
+} BlitDest;
+
+// Clip a w x h blit at (x, y) against the buffer, once.  sx and sy follow
+// the left and top edges into the source.  false when nothing is left.
+static boolean blitClip(int16_t x, int16_t y, int16_t &w, int16_t &h, int16_t &sx, int16_t &sy, BlitDest &d)
+{
+  if (x < 0)
+  {
+    sx -= x;
+    w += x;
+    x = 0;
+  }
+  if (y < 0)
+  {
+    sy -= y;
+    h += y;
+    y = 0;
+  }
+  if (w > bufWidth - x) w = bufWidth - x;
+  if (h > bufHeight - y) h = bufHeight - y;
+  if (w <= 0 || h <= 0)
+  {
+    return false;
+  }
+
+  uint16_t dBit = x * SSD1322_BITS_PER_PIXEL;
+  uint16_t nBits = w * SSD1322_BITS_PER_PIXEL;
+
+  d.pBuf = &buffer[(dBit >> 3) + y * bufStride];
+  d.bit = dBit & 7;
+  d.bytes = (d.bit + nBits + 7) >> 3;
+  d.firstMask = 0xFF >> d.bit;
+  d.lastMask = ((dBit + nBits) & 7) ? ~(0xFF >> ((dBit + nBits) & 7)) : 0xFF;
+  return true;
+}
+
+// Value of pixel i of a source row in buffer format
+static inline uint8_t bitmapPixel(const uint8_t *row, uint16_t i, boolean ram)
+{
+  uint16_t bit = i * SSD1322_BITS_PER_PIXEL;
+  uint8_t b = ram ? row[bit >> 3] : pgm_read_byte(row + (bit >> 3));
+  return (b >> (8 - SSD1322_BITS_PER_PIXEL - (bit & 7))) & SSD1322_RIGHT_PIXEL;
+}
+
+/**
+ * Copy a bitmap into the buffer, clipped at every edge, for any x and y and
+ * the current raster op.  The bitmap has the buffer's pixel format, rows
+ * padded to whole bytes.  This is the engine behind fastDrawBitmap() and the
+ * glyph and sprite drawing.
+ * @param x, y - top left corner on screen, may be negative.
+ * @param bitmap - the pixels, in PROGMEM unless SSD1322_BLIT_RAM is given.
+ * @param w, h - size in pixels.
+ * @param color - colour of the set pixels with SSD1322_BLIT_MASKED, picks the
+ * raster op under SSD1322_ROP_NORMAL otherwise.
+ * @param flags - SSD1322_BLIT_MASKED (0) writes the colour where the bitmap
+ * is not 0 and leaves the rest alone.  SSD1322_BLIT_OPAQUE writes the
+ * bitmap's own pixels.  Add SSD1322_BLIT_RAM for a bitmap in RAM.
+ */
+void ESP8266_SSD1322::blit(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h,
+		uint16_t color, uint8_t flags)
+{
+  uint16_t stride = ((uint32_t)max(w, (int16_t)0) * SSD1322_BITS_PER_PIXEL + 7) >> 3;
+  blitRect(x, y, bitmap, stride, 0, w, h, color, flags);
+}
+
+// blit() from a window of a larger bitmap: w x h pixels starting at pixel sx
+// of each row, rows stride bytes apart.
+void ESP8266_SSD1322::blitRect(int16_t x, int16_t y, const uint8_t *bitmap, uint16_t stride, int16_t sx,
+		int16_t w, int16_t h, uint16_t color, uint8_t flags)
+{
+  boolean ram = (flags & SSD1322_BLIT_RAM) != 0;
+  uint8_t mode = (flags & SSD1322_BLIT_OPAQUE) ? SSD1322_BLIT_OPAQUE : SSD1322_BLIT_MASKED;
+  uint8_t op, src;
+
+  if (!flushRotation && rotation)
+  {
+    // the buffer is not in screen orientation, go pixel by pixel
+    for (int16_t j = 0; j < h; j++)
+    {
+      const uint8_t *row = bitmap + (uint32_t)j * stride;
+      for (int16_t i = 0; i < w; i++)
+      {
+        uint8_t p = bitmapPixel(row, sx + i, ram);
+        if (mode == SSD1322_BLIT_OPAQUE)
+        {
+#ifdef SSD1322_256_64_1
+          // an INVERSE image only flips its set pixels
+          if (p)
+            drawPixel(x + i, y + j, (color == INVERSE) ? INVERSE : WHITE);
+          else if (color != INVERSE || rasterOp != SSD1322_ROP_NORMAL)
+            drawPixel(x + i, y + j, BLACK);
+#else
+          drawPixel(x + i, y + j, p);
+#endif
+        }
+        else if (p)
+        {
+          drawPixel(x + i, y + j, color);
+        }
+      }
+    }
+    return;
+  }
+
+  BlitDest d;
+  int16_t sy = 0;
+  if (!blitClip(x, y, w, h, sx, sy, d))
+  {
+    return;
+  }
+
+  resolveRop(color, op, src);
+  BlitRowFn kernel = blitRowTable[mode][op];
+
+  uint32_t sBit = (uint32_t)sx * SSD1322_BITS_PER_PIXEL;
+  uint16_t sBytes = ((sBit & 7) + w * SSD1322_BITS_PER_PIXEL + 7) >> 3;
+
+  // blitLine[1] takes the first source byte; the destination's first byte
+  // starts d.bit bits before the first source pixel
+  uint8_t lead = 8 + (sBit & 7) - d.bit;
+  const uint8_t *line = &blitLine[lead >> 3];
+  uint8_t sh = lead & 7;
+
+  const uint8_t *pSrc = bitmap + (uint32_t)sy * stride + (sBit >> 3);
+  uint8_t *pBuf = d.pBuf;
+
+  if (mode == SSD1322_BLIT_OPAQUE && op == SSD1322_ROP_COPY && sh == 0 &&
+      d.firstMask == 0xFF && d.lastMask == 0xFF)
+  {
+    // whole bytes that line up: straight copies
+    while (h--)
+    {
+      if (ram)
+        memcpy(pBuf, pSrc, d.bytes);
+      else
+        memcpy_P(pBuf, pSrc, d.bytes);
+      pSrc += stride;
+      pBuf += bufStride;
+    }
+    return;
+  }
+
+  blitLine[0] = 0;
+  blitLine[sBytes + 1] = 0;
+  while (h--)
+  {
+    if (ram)
+      memcpy(&blitLine[1], pSrc, sBytes);
+    else
+      memcpy_P(&blitLine[1], pSrc, sBytes);
+
+    kernel(pBuf, line, NULL, sh, d.bytes, d.firstMask, d.lastMask, src);
+    pSrc += stride;
+    pBuf += bufStride;
+  }
+}
+
+/***************************************************************************************
+** Function name:           fastDrawBitmap
+** Descriptions:            draw a bitmap from PROGMEM, clipped, at any position.  In 1 bit
+** mode the set bits are drawn in color and the clear bits left alone.  In 4 bit mode the
+** bitmap holds gray levels, 2 pixels per byte, that are the source of the raster op, so
+** SSD1322_ROP_MAX or SSD1322_ROP_XOR overlay an image instead of replacing it.
+***************************************************************************************/
+void ESP8266_SSD1322::fastDrawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint8_t color)
+{
+#ifdef SSD1322_256_64_4
+  blit(x, y, bitmap, w, h, color, SSD1322_BLIT_OPAQUE);
+#else
+  blit(x, y, bitmap, w, h, color, SSD1322_BLIT_MASKED);
+#endif
+}
+
+#ifdef SSD1322_256_64_4
+/**
+ * Draw a 1 bit per pixel bitmap (MSB left, rows padded to whole bytes) in
+ * gray levels, clipped, at any x.  Each source nibble expands through a 16
+ * entry table to two buffer bytes with the colours already in place.
+ * @param fg - gray level of the set bits.
+ * @param bg - gray level of the clear bits, or SSD1322_TRANSPARENT to leave
+ * the buffer alone there.
+ * @param flags - SSD1322_BLIT_RAM for a bitmap in RAM.
+ */
+void ESP8266_SSD1322::drawMonoBitmap4(int16_t x, int16_t y, const uint8_t *bits, int16_t w, int16_t h,
+		uint16_t fg, uint16_t bg, uint8_t flags)
+{
+  boolean ram = (flags & SSD1322_BLIT_RAM) != 0;
+  boolean transparent = (bg == SSD1322_TRANSPARENT);
+
+  if (w <= 0)
+  {
+    return;
+  }
+  uint16_t stride = (w + 7) >> 3;
+
+  if (!flushRotation && rotation)
+  {
+    // the buffer is not in screen orientation, go pixel by pixel
+    for (int16_t j = 0; j < h; j++)
+    {
+      const uint8_t *row = bits + (uint32_t)j * stride;
+      for (int16_t i = 0; i < w; i++)
+      {
+        uint8_t b = ram ? row[i >> 3] : pgm_read_byte(row + (i >> 3));
+        if (b & (0x80 >> (i & 7)))
+          drawPixel(x + i, y + j, fg);
+        else if (!transparent)
+          drawPixel(x + i, y + j, bg);
+      }
+    }
+    return;
+  }
+
+  BlitDest d;
+  int16_t sx = 0, sy = 0;
+  if (!blitClip(x, y, w, h, sx, sy, d))
+  {
+    return;
+  }
+
+  uint8_t op, src;
+  resolveRop(fg, op, src);
+  BlitRowFn kernel = blitRowTable[transparent ? SSD1322_BLIT_MASKED : SSD1322_BLIT_OPAQUE][op];
+
+  // 4 source pixels to 2 buffer bytes, just a mask when the background shows through
+  uint8_t on = transparent ? 0x0F : (fg & 0x0F);
+  uint8_t off = transparent ? 0x00 : (bg & 0x0F);
+  uint8_t pairs[16][2];
+
+  for (uint8_t n = 0; n < 16; n++)
+  {
+    pairs[n][0] = (((n & 8) ? on : off) << 4) | ((n & 4) ? on : off);
+    pairs[n][1] = (((n & 2) ? on : off) << 4) | ((n & 1) ? on : off);
+  }
+
+  // whole source bytes are expanded, so the first pixel lands (sx & 7) * 4
+  // bits into blitLine[1]
+  uint16_t nSrc = ((sx & 7) + w + 7) >> 3;
+  uint8_t lead = 8 + (sx & 7) * 4 - d.bit;
+  const uint8_t *line = &blitLine[lead >> 3];
+  uint8_t sh = lead & 7;
+
+  const uint8_t *pSrc = bits + (uint32_t)sy * stride + (sx >> 3);
+  uint8_t *pBuf = d.pBuf;
+
+  blitLine[0] = 0;
+  blitLine[nSrc * 4 + 1] = 0;
+  while (h--)
+  {
+    register uint8_t *pOut = &blitLine[1];
+    for (uint16_t i = 0; i < nSrc; i++)
+    {
+      uint8_t b = ram ? pSrc[i] : pgm_read_byte(pSrc + i);
+      const uint8_t *hi = pairs[b >> 4];
+      const uint8_t *lo = pairs[b & 0x0F];
+
+      *pOut++ = hi[0];
+      *pOut++ = hi[1];
+      *pOut++ = lo[0];
+      *pOut++ = lo[1];
+    }
+
+    kernel(pBuf, line, NULL, sh, d.bytes, d.firstMask, d.lastMask, src);
+    pSrc += stride;
+    pBuf += bufStride;
+  }
+}
+
+// Pixel masks that go with blitLine for a keyed blit
+static uint8_t blitKeyLine[sizeof(blitLine)];
+
+/**
+ * Fill a 16 entry gray map for drawBitmap4(): lut[i] = i * scale / 16 + offset,
+ * limited to 0 .. 15.  scale 16 and offset 0 leave the levels as they are,
+ * scale 8 halves them, offset -4 darkens every level by 4.
+ */
+void ESP8266_SSD1322::makeGrayLut(uint8_t *lut, uint8_t scale, int8_t offset)
+{
+  for (uint8_t i = 0; i < 16; i++)
+  {
+    int16_t v = ((int16_t)i * scale >> 4) + offset;
+    lut[i] = (v < 0) ? 0 : ((v > 15) ? 15 : v);
+  }
+}
+
+/**
+ * Draw a 4 bit per pixel bitmap (high nibble left, rows padded to whole
+ * bytes) at any x, clipped on all sides, under the current raster op.
+ * @param key - gray level of the bitmap to leave out, SSD1322_TRANSPARENT
+ * for none.  It is matched before the gray map.
+ * @param lut - optional 16 entry gray map in RAM, see makeGrayLut().
+ * @param flags - SSD1322_BLIT_RAM for a bitmap in RAM.
+ */
+void ESP8266_SSD1322::drawBitmap4(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h,
+		uint16_t key, const uint8_t *lut, uint8_t flags)
+{
+  boolean ram = (flags & SSD1322_BLIT_RAM) != 0;
+  boolean keyed = (key != SSD1322_TRANSPARENT);
+
+  if (!keyed && !lut)
+  {
+    // plain copy, aligned rows become memcpy
+    blit(x, y, bitmap, w, h, WHITE, SSD1322_BLIT_OPAQUE | (flags & SSD1322_BLIT_RAM));
+    return;
+  }
+  if (w <= 0)
+  {
+    return;
+  }
+  uint16_t stride = ((uint32_t)w * 4 + 7) >> 3;
+
+  if (!flushRotation && rotation)
+  {
+    // the buffer is not in screen orientation, go pixel by pixel
+    for (int16_t j = 0; j < h; j++)
+    {
+      const uint8_t *row = bitmap + (uint32_t)j * stride;
+      for (int16_t i = 0; i < w; i++)
+      {
+        uint8_t p = bitmapPixel(row, i, ram);
+        if (!keyed || p != key)
+          drawPixel(x + i, y + j, lut ? lut[p] : p);
+      }
+    }
+    return;
+  }
+
+  BlitDest d;
+  int16_t sx = 0, sy = 0;
+  if (!blitClip(x, y, w, h, sx, sy, d))
+  {
+    return;
+  }
+
+  uint8_t op, src;
+  resolveRop(WHITE, op, src);
+  BlitRowFn kernel = blitRowTable[keyed ? BLIT_KEYED : SSD1322_BLIT_OPAQUE][op];
+
+  uint32_t sBit = (uint32_t)sx * 4;
+  uint16_t sBytes = ((sBit & 7) + w * 4 + 7) >> 3;
+  uint8_t lead = 8 + (sBit & 7) - d.bit;
+  const uint8_t *line = &blitLine[lead >> 3];
+  const uint8_t *keyLine = &blitKeyLine[lead >> 3];
+  uint8_t sh = lead & 7;
+  uint8_t keyByte = (key & 0x0F) * 0x11;
+
+  const uint8_t *pSrc = bitmap + (uint32_t)sy * stride + (sBit >> 3);
+  uint8_t *pBuf = d.pBuf;
+
+  blitLine[0] = blitKeyLine[0] = 0;
+  blitLine[sBytes + 1] = blitKeyLine[sBytes + 1] = 0;
+  while (h--)
+  {
+    for (uint16_t i = 0; i < sBytes; i++)
+    {
+      uint8_t b = ram ? pSrc[i] : pgm_read_byte(pSrc + i);
+
+      // pixels that differ from the key get drawn
+      blitKeyLine[i + 1] = setPixels(b ^ keyByte);
+      blitLine[i + 1] = lut ? ((lut[b >> 4] << 4) | (lut[b & 0x0F] & 0x0F)) : b;
+    }
+
+    kernel(pBuf, line, keyLine, sh, d.bytes, d.firstMask, d.lastMask, src);
+    pSrc += stride;
+    pBuf += bufStride;
+  }
+}
+
+#endif
+
+// One row made on the fly (a glyph row, decoded, dithered) on its way to blitRect()
+static uint8_t stageLine[sizeof(blitLine)];
+
+// A glyph row with the bits past its width cleared, and room for the widest gap
+static uint8_t glyphBits[(255 + 127 + 7) / 8 + 1];
+
+// Set n bits of a bit string from bit i on
+static void setBits(uint8_t *bits, uint16_t i, uint16_t n)
+{
+  for (; n && (i & 7); i++, n--)
+    bits[i >> 3] |= 0x80 >> (i & 7);
+  for (; n >= 8; i += 8, n -= 8)
+    bits[i >> 3] = 0xFF;
+  for (; n; i++, n--)
+    bits[i >> 3] |= 0x80 >> (i & 7);
+}
+
+// Reads the rows of a glyph into glyphBits one after another, whatever the
+// font's encoding, with the bits past the glyph's width cleared
+typedef struct {
+  const uint8_t *p;
+  uint8_t encoding;
+  uint8_t width;
+  uint8_t left;		// pixels left in the current run
+  boolean ink;		// the current run is ink
+} GlyphRows;
+
+static void glyphRowsStart(GlyphRows &g, uint8_t encoding, uint32_t flash_address, uint8_t width)
+{
+  g.p = (const uint8_t *)flash_address;
+  g.encoding = encoding;
+  g.width = width;
+  g.left = 0;
+  g.ink = false;
+}
+
+static void glyphRowsNext(GlyphRows &g)
+{
+  uint8_t w = (g.width + 7) >> 3;
+
+  if (g.encoding == SSD1322_FONT_RLE)
+  {
+    memset(glyphBits, 0, w);
+    for (uint8_t c = 0; c < g.width; )
+    {
+      if (!g.left)
+      {
+        uint8_t b = pgm_read_byte(g.p++);
+        g.ink = (b & 0x80) != 0;
+        g.left = (b & 0x7F) + 1;
+      }
+      uint8_t n = min(g.left, (uint8_t)(g.width - c));
+      if (g.ink)
+        setBits(glyphBits, c, n);
+      c += n;
+      g.left -= n;
+    }
+    return;
+  }
+
+  memcpy_P(glyphBits, g.p, w);
+  g.p += w;
+  if (g.width & 7)
+  {
+    glyphBits[w - 1] &= ~(0xFF >> (g.width & 7));
+  }
+}
+
+// Put columns from .. from + n - 1 of a glyph row, each source bit scale
+// pixels wide, into stageLine in buffer format: on where the bit is set, off
+// where it is clear (pixel values, 0 / 1 in 1 bit mode).  Returns the pixel
+// of stageLine[0] the first column lands on, for blitRect()'s sx.
+static uint8_t stageGlyph(uint8_t scale, uint16_t from, uint16_t n, uint8_t on, uint8_t off)
+{
+  if (scale == 1)
+  {
+    // whole source bytes, the first column keeps its place in its byte
+    const uint8_t *pSrc = &glyphBits[from >> 3];
+    uint8_t bytes = ((from & 7) + n + 7) >> 3;
+#ifdef SSD1322_256_64_4
+    // two source bits to one buffer byte
+    uint8_t duo[4] = { (uint8_t)(off * 0x11), (uint8_t)((off << 4) | on), (uint8_t)((on << 4) | off), (uint8_t)(on * 0x11) };
+    uint8_t *pOut = stageLine;
+    while (bytes--)
+    {
+      uint8_t b = *pSrc++;
+      *pOut++ = duo[b >> 6];
+      *pOut++ = duo[(b >> 4) & 3];
+      *pOut++ = duo[(b >> 2) & 3];
+      *pOut++ = duo[b & 3];
+    }
+#else
+    uint8_t onMask = on ? 0xFF : 0x00;
+    uint8_t offMask = off ? 0xFF : 0x00;
+    for (uint8_t i = 0; i < bytes; i++)
+    {
+      stageLine[i] = (pSrc[i] & onMask) | (~pSrc[i] & offMask);
+    }
+#endif
+    return from & 7;
+  }
+
+  // scaled up: a run of scale pixels per source bit
+  uint16_t s = from / scale;
+  uint8_t left = scale - from % scale;
+  uint8_t v = (glyphBits[s >> 3] & (0x80 >> (s & 7))) ? on : off;
+  uint8_t acc = 0;
+  uint8_t *pOut = stageLine;
+
+  for (uint16_t i = 0; i < n; i++)
+  {
+    acc = (acc << SSD1322_BITS_PER_PIXEL) | v;
+    if ((i & (8 / SSD1322_BITS_PER_PIXEL - 1)) == 8 / SSD1322_BITS_PER_PIXEL - 1)
+    {
+      *pOut++ = acc;
+    }
+    if (!--left)
+    {
+      s++;
+      left = scale;
+      v = (glyphBits[s >> 3] & (0x80 >> (s & 7))) ? on : off;
+    }
+  }
+  if (n & (8 / SSD1322_BITS_PER_PIXEL - 1))
+  {
+    *pOut = acc << (8 - (n & (8 / SSD1322_BITS_PER_PIXEL - 1)) * SSD1322_BITS_PER_PIXEL);
+  }
+  return 0;
+}
+
+// A glyph in the cache: its rows already in buffer format, starting phase
+// bits into the first byte, ready to be written over the buffer.  A solid
+// glyph (opaque, nothing past its advance) stores the pixel bytes only; the
+// rest store them followed by the masks of the pixels to write.
+typedef struct {
+  const SSD1322_Font *font;	// NULL for a free slot
+  uint16_t code;		// glyph index in the font
+  uint8_t scale;	// textsize
+  uint8_t phase;	// bit of the first pixel in its byte
+  uint8_t on, off;	// ink and background pixel values
+  boolean opaque;
+  boolean solid;
+  uint8_t bytes;	// per row
+  uint8_t rows;
+  uint16_t cols;	// pixels across
+  uint16_t offset, size;	// where in the cache memory
+  uint16_t used;	// lookup count when last drawn
+} GlyphEntry;
+
+static GlyphEntry glyphEntries[SSD1322_GLYPH_CACHE_SLOTS];
+static uint8_t *glyphCache = NULL;
+static uint16_t glyphCacheSize = 0, glyphCacheUsed = 0, glyphClock = 0;
+static SSD1322_GlyphCacheStats glyphStat;
+
+/**
+ * Keep recently drawn glyphs in the given memory, already in the buffer's
+ * format at their colours and bit position, so drawing one again is a row
+ * of byte writes instead of a glyph decode.  Glyphs are dropped least
+ * recently used first.  NULL or size 0 turns the cache off.  Counters are
+ * reset.
+ */
+void ESP8266_SSD1322::setGlyphCache(uint8_t *mem, uint16_t size)
+{
+  glyphCache = size ? mem : NULL;
+  glyphCacheSize = mem ? size : 0;
+  memset(&glyphStat, 0, sizeof(glyphStat));
+  flushGlyphCache();
+}
+
+// Forget every cached glyph, for a font whose tables have changed
+void ESP8266_SSD1322::flushGlyphCache(void)
+{
+  memset(glyphEntries, 0, sizeof(glyphEntries));
+  glyphCacheUsed = 0;
+}
+
+SSD1322_GlyphCacheStats ESP8266_SSD1322::getGlyphCacheStats(void)
+{
+  SSD1322_GlyphCacheStats stats = glyphStat;
+  uint32_t lookups = stats.hits + stats.misses;
+
+  stats.hitRate = lookups ? (uint8_t)((stats.hits * 100ULL) / lookups) : 0;
+  stats.glyphs = 0;
+  for (uint8_t i = 0; i < SSD1322_GLYPH_CACHE_SLOTS; i++)
+  {
+    if (glyphEntries[i].font)
+      stats.glyphs++;
+  }
+  stats.bytes = glyphCacheUsed;
+  return stats;
+}
+
+// Drop a cached glyph and close the gap it leaves in the cache memory
+static void glyphEvict(GlyphEntry *e)
+{
+  uint16_t end = e->offset + e->size;
+
+  memmove(glyphCache + e->offset, glyphCache + end, glyphCacheUsed - end);
+  for (uint8_t i = 0; i < SSD1322_GLYPH_CACHE_SLOTS; i++)
+  {
+    if (glyphEntries[i].font && glyphEntries[i].offset >= end)
+      glyphEntries[i].offset -= e->size;
+  }
+  glyphCacheUsed -= e->size;
+  e->font = NULL;
+  glyphStat.evictions++;
+}
+
+// Render the rows of a glyph into a new cache entry.  Columns below solidW
+// take on or off, the ink to inkW takes on and the rest stays masked off.
+static void glyphRender(GlyphEntry *e, uint32_t flash_address, uint8_t width, int16_t solidW, int16_t inkW)
+{
+  uint8_t *v = glyphCache + e->offset;
+  uint8_t *m = v + e->bytes;
+  uint16_t step = e->solid ? e->bytes : 2 * e->bytes;
+  GlyphRows g;
+
+  glyphRowsStart(g, e->font->encoding, flash_address, width);
+  memset(glyphBits, 0, sizeof(glyphBits));
+  for (uint8_t i = 0; i < e->rows; i++, v += step, m += step)
+  {
+    glyphRowsNext(g);
+
+    memset(v, 0, e->solid ? e->bytes : 2 * e->bytes);
+    uint16_t s = 0;
+    uint8_t left = e->scale;
+    uint16_t bit = e->phase;
+    for (int16_t c = 0; c < e->cols; c++, bit += SSD1322_BITS_PER_PIXEL)
+    {
+      boolean ink = (glyphBits[s >> 3] & (0x80 >> (s & 7))) != 0;
+      uint8_t sh = 8 - SSD1322_BITS_PER_PIXEL - (bit & 7);
+
+      if (c < solidW || (ink && c < inkW))
+      {
+        v[bit >> 3] |= (ink ? e->on : e->off) << sh;
+        if (!e->solid)
+          m[bit >> 3] |= SSD1322_RIGHT_PIXEL << sh;
+      }
+      if (!--left)
+      {
+        s++;
+        left = e->scale;
+      }
+    }
+  }
+}
+
+// The cache entry of a glyph drawn at this phase and colours, made on a
+// miss.  NULL when it does not fit in the cache.
+static const GlyphEntry *glyphLookup(const SSD1322_Font *font, uint16_t code, uint32_t flash_address, uint8_t width,
+                                     uint8_t scale, uint8_t phase, boolean opaque, uint8_t on, uint8_t off)
+{
+  GlyphEntry *e;
+
+  glyphClock++;
+  for (uint8_t i = 0; i < SSD1322_GLYPH_CACHE_SLOTS; i++)
+  {
+    e = &glyphEntries[i];
+    if (e->font == font && e->code == code && e->scale == scale && e->phase == phase &&
+        e->opaque == opaque && e->on == on && (!opaque || e->off == off))
+    {
+      e->used = glyphClock;
+      glyphStat.hits++;
+      return e;
+    }
+  }
+  glyphStat.misses++;
+
+  // the pixels to write: background to the advance, ink to the glyph width
+  int16_t inkW = width * scale;
+  int16_t solidW = opaque ? (width + font->gap) * scale : 0;
+  if (solidW < 0)
+    solidW = 0;
+
+  // ink past the advance (negative gap) needs masks even when opaque
+  boolean solid = opaque;
+  if (opaque && solidW < inkW)
+  {
+    GlyphRows g;
+    uint8_t from = width + font->gap;
+
+    glyphRowsStart(g, font->encoding, flash_address, width);
+    for (uint8_t i = 0; solid && i < font->height; i++)
+    {
+      glyphRowsNext(g);
+      for (uint8_t c = from; c < width; c++)
+      {
+        if (glyphBits[c >> 3] & (0x80 >> (c & 7)))
+        {
+          solid = false;
+          break;
+        }
+      }
+    }
+  }
+
+  uint16_t cols = solid ? solidW : max(solidW, inkW);
+  uint16_t bytes = (phase + cols * SSD1322_BITS_PER_PIXEL + 7) >> 3;
+  uint32_t size = (uint32_t)bytes * font->height * (solid ? 1 : 2);
+  if (cols == 0 || bytes > 0xFF || size > glyphCacheSize)
+  {
+    return NULL;
+  }
+
+  // a free slot, then room, dropping the least recently drawn glyphs
+  for (;;)
+  {
+    GlyphEntry *slot = NULL, *oldest = NULL;
+    for (uint8_t i = 0; i < SSD1322_GLYPH_CACHE_SLOTS; i++)
+    {
+      e = &glyphEntries[i];
+      if (!e->font)
+        slot = e;
+      else if (!oldest || (uint16_t)(glyphClock - e->used) > (uint16_t)(glyphClock - oldest->used))
+        oldest = e;
+    }
+    if (slot && glyphCacheUsed + size <= glyphCacheSize)
+    {
+      e = slot;
+      break;
+    }
+    glyphEvict(oldest);
+  }
+
+  e->font = font;
+  e->code = code;
+  e->scale = scale;
+  e->phase = phase;
+  e->opaque = opaque;
+  e->on = on;
+  e->off = opaque ? off : on;
+  e->solid = solid;
+  e->bytes = bytes;
+  e->rows = font->height;
+  e->cols = cols;
+  e->offset = glyphCacheUsed;
+  e->size = size;
+  e->used = glyphClock;
+  glyphCacheUsed += size;
+
+  glyphRender(e, flash_address, width, solidW, inkW);
+  return e;
+}
+
+// Write a cached glyph with its first pixel at buffer (x, y), each row
+// scale lines down.  x is on the screen; rows off the top or bottom are cut.
+static void glyphDraw(const GlyphEntry *e, int16_t x, int16_t y)
+{
+  const uint8_t *v = glyphCache + e->offset;
+  uint16_t step = e->solid ? e->bytes : 2 * e->bytes;
+  uint8_t n = e->bytes;
+  uint16_t endBit = e->phase + e->cols * SSD1322_BITS_PER_PIXEL;
+  uint8_t firstMask = 0xFF >> e->phase;
+  uint8_t lastMask = (endBit & 7) ? ~(0xFF >> (endBit & 7)) : 0xFF;
+  uint8_t *pCol = &buffer[(x * SSD1322_BITS_PER_PIXEL) >> 3];
+
+  if (n == 1)
+  {
+    firstMask &= lastMask;
+  }
+
+  for (uint8_t i = 0; i < e->rows; i++, v += step)
+  {
+    for (uint8_t k = 0; k < e->scale; k++, y++)
+    {
+      if (y < 0)
+        continue;
+      if (y >= bufHeight)
+        return;
+
+      register uint8_t *pBuf = pCol + y * bufStride;
+      if (e->solid)
+      {
+        *pBuf = (*pBuf & ~firstMask) | (v[0] & firstMask);
+        if (n > 1)
+        {
+          memcpy(pBuf + 1, v + 1, n - 2);
+          pBuf[n - 1] = (pBuf[n - 1] & ~lastMask) | (v[n - 1] & lastMask);
+        }
+      }
+      else
+      {
+        const uint8_t *m = v + n;
+        for (uint8_t b = 0; b < n; b++)
+        {
+          pBuf[b] = (pBuf[b] & ~m[b]) | v[b];
+        }
+      }
+    }
+  }
+}
+
+// Glyph widths of the last font measured, copied to RAM so measuring a
+// string costs no flash reads
+static const SSD1322_Font *widthFont = NULL;
+static uint8_t widthCache[96];
+
+/**
+ * Put a font under a size number for drawChar(), drawString() and the rest,
+ * replacing what was there (NULL takes it away).  The descriptor is used in
+ * place, so it must outlive its registration.
+ * @return false for a size past SSD1322_MAX_FONTS, 0 (the GLCD font) or an
+ * encoding this build cannot draw.
+ */
+boolean ESP8266_SSD1322::registerFont(uint8_t size, const SSD1322_Font *font)
+{
+  if (size == 0 || size >= SSD1322_MAX_FONTS)
+  {
+    return false;
+  }
+  if (font && font->encoding > SSD1322_FONT_ALPHA)
+  {
+    return false;
+  }
+  fontTable[size] = font;
+  widthFont = NULL;
+  flushGlyphCache();
+  return true;
+}
+
+// The font under a size number, NULL if there is none
+const SSD1322_Font *ESP8266_SSD1322::getFont(uint8_t size)
+{
+  return (size < SSD1322_MAX_FONTS) ? fontTable[size] : NULL;
+}
+
+// Width and flash address of glyph i of a font.  A packed font gives both
+// with one aligned 32 bit read, and 0 as the address of a blank glyph.
+// pgm_read_dword() warns about strict-aliasing, the table holds pointers
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstrict-aliasing"
+static inline uint8_t fontGlyph(const SSD1322_Font *font, uint16_t i, uint32_t &glyph)
+{
+  if (font->index)
+  {
+    uint32_t r = pgm_read_dword(&font->index[i]);
+    glyph = (r & SSD1322_GLYPH_BLANK) ? 0 : (uint32_t)(uintptr_t)font->data + (r & 0xFFFF);
+    return r >> 16;
+  }
+  glyph = pgm_read_dword(&font->glyphs[i]);
+  return pgm_read_byte(font->widths + i);
+}
+#pragma GCC diagnostic pop
+
+static inline uint8_t fontWidth(const SSD1322_Font *font, uint16_t i)
+{
+  return font->index ? pgm_read_dword(&font->index[i]) >> 16 : pgm_read_byte(font->widths + i);
+}
+
+static inline uint8_t glyphWidth(const SSD1322_Font *font, uint16_t c)
+{
+  return (c < font->count && c < sizeof(widthCache)) ? widthCache[c] : fontWidth(font, c);
+}
+
+// Glyph index of code point c in a font, -1 if the font lacks it: the first
+// block by subtraction, the ranges by halves
+static int32_t fontIndex(const SSD1322_Font *font, uint32_t c)
+{
+  if (c - font->first < font->count)
+  {
+    return c - font->first;
+  }
+
+  uint16_t lo = 0, hi = font->ranges ? font->rangeCount : 0;
+  while (lo < hi)
+  {
+    uint16_t mid = (lo + hi) >> 1;
+    const SSD1322_CodeRange *r = &font->ranges[mid];
+    uint16_t first = pgm_read_word(&r->first);
+    if (c < first)
+    {
+      hi = mid;
+    }
+    else if (c - first < pgm_read_word(&r->count))
+    {
+      return pgm_read_word(&r->glyph) + (c - first);
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+  return -1;
+}
+
+// The next code point of a UTF-8 string, moving the string past it.  A byte
+// that does not start a well formed sequence stands for itself (Latin-1),
+// and code points past 0xFFFF come out as U+FFFD.
+static uint16_t utf8Next(const char *&string)
+{
+  const uint8_t *s = (const uint8_t *)string;
+  uint8_t b = s[0];
+  uint8_t n;
+  uint32_t c;
+
+  if (b < 0xC2 || b > 0xF4)
+  {
+    string++;
+    return b;
+  }
+  else if (b < 0xE0)
+  {
+    n = 1;
+    c = b & 0x1F;
+  }
+  else if (b < 0xF0)
+  {
+    n = 2;
+    c = b & 0x0F;
+  }
+  else
+  {
+    n = 3;
+    c = b & 0x07;
+  }
+
+  for (uint8_t i = 1; i <= n; i++)
+  {
+    // the string's 0 ends a short sequence here too
+    if ((s[i] & 0xC0) != 0x80)
+    {
+      string++;
+      return b;
+    }
+    c = (c << 6) | (s[i] & 0x3F);
+  }
+  if ((n == 2 && c < 0x800) || (n == 3 && c < 0x10000) || (c >= 0xD800 && c < 0xE000))
+  {
+    // overlong, or a surrogate
+    string++;
+    return b;
+  }
+  string += n + 1;
+  return (c > 0xFFFF) ? 0xFFFD : c;
+}
+
+/**
+ * The next code point of a UTF-8 string, as drawString() reads it, moving
+ * the string past it.
+ */
+uint16_t ESP8266_SSD1322::decodeUtf8(const char *&string)
+{
+  return utf8Next(string);
+}
+
+// Advance of a string in a font, unscaled.  right is where its ink ends,
+// which a negative gap puts past the advance.
+static int stringWidth(const SSD1322_Font *font, const char *string, int &right)
+{
+  if (font != widthFont)
+  {
+    uint8_t n = min((size_t)font->count, sizeof(widthCache));
+    if (font->index)
+    {
+      for (uint8_t i = 0; i < n; i++)
+      {
+        widthCache[i] = fontWidth(font, i);
+      }
+    }
+    else
+    {
+      memcpy_P(widthCache, font->widths, n);
+    }
+    widthFont = font;
+  }
+
+  int len = 0;
+  right = 0;
+  while (*string)
+  {
+    int32_t c = fontIndex(font, utf8Next(string));
+    if (c >= 0)
+    {
+      uint8_t w = glyphWidth(font, c);
+      right = max(right, len + max((int)w, w + font->gap));
+      len += w + font->gap;
+    }
+  }
+  return len;
+}
+
+/***************************************************************************************
+** Function name:           drawUnicode
+** Descriptions:            draw a unicode
+***************************************************************************************/
+int ESP8266_SSD1322::drawUnicode(unsigned int uniCode, int x, int y, int size)
+{
+//Serial.println("drawUnicode:E");
+   const SSD1322_Font *font = getFont(size);
+   if (!font) {
+	   return 0;
+   }
+
+   int32_t index = fontIndex(font, uniCode);
+   if (index < 0) {
+	   return 0;
+   }
+   uniCode = index;
+
+   uint32_t flash_address;
+   uint8_t width = fontGlyph(font, uniCode, flash_address);
+   uint8_t height = font->height;
+   int8_t gap = font->gap;
+
+   if (!flash_address && !font->index) {
+	   return 0;
+   }
+
+	uint8_t w = (width+7)/8;
+	uint8_t scale = textsize;
+
+	// cell columns, scaled: the background covers the advance, the ink the glyph width
+	int16_t inkW = width*scale;
+	int16_t bgW = (width+gap)*scale;
+	int16_t cellW = max(inkW, bgW);
+
+	// the columns of the cell that can show
+	int16_t c0 = max(0, -x);
+	int16_t c1 = min((int)cellW, _width - x);
+	if (c0 >= c1 || y >= _height || y + height*scale <= 0)
+	{
+		return (width+gap)*textsize;
+	}
+
+	boolean opaque = (textcolor != textbgcolor);
+	if (!flash_address)
+	{
+		// a blank glyph of a packed font, only its background to draw
+		if (opaque)
+		{
+			fillRect(x, y, bgW, height*scale, textbgcolor);
+		}
+		return (width+gap)*textsize;
+	}
+	uint8_t on, off;
+#ifdef SSD1322_256_64_4
+	boolean onePass = (rasterOp == SSD1322_ROP_NORMAL);
+	on = textcolor & 0x0F;
+	off = textbgcolor & 0x0F;
+	const uint8_t inkOn = 0x0F;	// masked rows only need the set pixels marked
+#else
+	// background and ink go into one opaque row unless a raster op or INVERSE
+	// has to see them separately
+	boolean onePass = (rasterOp == SSD1322_ROP_NORMAL) && (textcolor != INVERSE) && (textbgcolor != INVERSE);
+	on = (textcolor != BLACK);
+	off = (textbgcolor != BLACK);
+	const uint8_t inkOn = 1;
+#endif
+
+	if (onePass && glyphCache && c0 == 0 && c1 == cellW && (flushRotation || !rotation) &&
+			font->encoding != SSD1322_FONT_ALPHA)
+	{
+		// the whole cell shows, draw it from the glyph cache
+		const GlyphEntry *e = glyphLookup(font, uniCode, flash_address, width, scale,
+				(x * SSD1322_BITS_PER_PIXEL) & 7, opaque, on, off);
+		if (e)
+		{
+			glyphDraw(e, x, y);
+			return (width+gap)*textsize;
+		}
+	}
+
+	if (opaque && !onePass)
+	{
+		// background first, then the ink on top of it
+		fillRect(x, y, bgW, height*scale, textbgcolor);
+		opaque = false;
+	}
+
+	if (font->encoding == SSD1322_FONT_RLE)
+	{
+		drawRunGlyph(flash_address, x, y, width, height, gap, opaque);
+		return (width+gap)*textsize;
+	}
+	if (font->encoding == SSD1322_FONT_ALPHA)
+	{
+		drawAlphaGlyph(flash_address, x, y, width, height, gap, opaque);
+		return (width+gap)*textsize;
+	}
+
+	// opaque: background and ink to the advance, ink only past it (negative gap)
+	int16_t solid = opaque ? min((int)c1, (int)bgW) : c0;
+	int16_t ink1 = min((int)c1, (int)inkW);
+
+	memset(glyphBits, 0, sizeof(glyphBits));
+	int16_t pY = y;
+	for (uint8_t i = 0; i < height; i++, pY += scale)
+	{
+		if (pY + scale <= 0)
+		{
+			continue;
+		}
+		if (pY >= _height)
+		{
+			break;
+		}
+
+		memcpy_P(glyphBits, (uint8_t *)flash_address + w*i, w);
+		if (width & 7)
+		{
+			glyphBits[w - 1] &= ~(0xFF >> (width & 7));
+		}
+
+		// the same staged row down scale lines, stride 0
+		if (solid > c0)
+		{
+			uint8_t sx = stageGlyph(scale, c0, solid - c0, on, off);
+			blitRect(x + c0, pY, stageLine, 0, sx, solid - c0, scale, textcolor,
+					SSD1322_BLIT_OPAQUE | SSD1322_BLIT_RAM);
+		}
+		int16_t from = max(c0, solid);
+		if (ink1 > from)
+		{
+			uint8_t sx = stageGlyph(scale, from, ink1 - from, inkOn, 0);
+			blitRect(x + from, pY, stageLine, 0, sx, ink1 - from, scale, textcolor,
+					SSD1322_BLIT_MASKED | SSD1322_BLIT_RAM);
+		}
+	}
+//Serial.println("drawUnicode:X");
+	return (width+gap)*textsize;        // x +
+}
+
+// Draw a run length encoded glyph run by run: each run of ink, or of
+// background when opaque, is a span textsize lines tall, so no pixel is
+// tested.  The background stops at the advance and fills a positive gap.
+void ESP8266_SSD1322::drawRunGlyph(uint32_t glyph, int x, int y, uint8_t width, uint8_t height, int8_t gap, boolean opaque)
+{
+	const uint8_t *p = (const uint8_t *)glyph;
+	uint8_t scale = textsize;
+	int16_t bgEnd = width + gap;
+	uint8_t inkOp, inkSrc, bgOp, bgSrc;
+
+	resolveRop(textcolor, inkOp, inkSrc);
+	resolveRop(textbgcolor, bgOp, bgSrc);
+
+	if (opaque && gap > 0)
+	{
+		fillRect(x + width*scale, y, gap*scale, height*scale, textbgcolor);
+	}
+
+	uint8_t left = 0;
+	boolean ink = false;
+	for (uint8_t row = 0; row < height; row++)
+	{
+		int16_t pY = y + row*scale;
+		if (pY >= _height)
+		{
+			break;
+		}
+
+		for (uint8_t c = 0; c < width; )
+		{
+			if (!left)
+			{
+				uint8_t b = pgm_read_byte(p++);
+				ink = (b & 0x80) != 0;
+				left = (b & 0x7F) + 1;
+			}
+			uint8_t n = min(left, (uint8_t)(width - c));
+
+			if (ink || (opaque && c < bgEnd))
+			{
+				int16_t w = ink ? n : min((int16_t)n, (int16_t)(bgEnd - c));
+				for (uint8_t k = 0; k < scale; k++)
+				{
+					if (ink)
+						hspan(x + c*scale, pY + k, w*scale, inkOp, inkSrc);
+					else
+						hspan(x + c*scale, pY + k, w*scale, bgOp, bgSrc);
+				}
+			}
+			c += n;
+			left -= n;
+		}
+	}
+}
+
+// Coverage of column c of a 4 bit glyph row
+static inline uint8_t alphaAt(const uint8_t *row, uint8_t c)
+{
+	uint8_t b = pgm_read_byte(row + (c >> 1));
+	return (c & 1) ? (b & 0x0F) : (b >> 4);
+}
+
+#ifdef SSD1322_256_64_4
+// alphaBlend[a][d]: gray d moved a/15 of the way to the ink gray alphaInk
+static uint8_t alphaBlend[16][16];
+static uint8_t alphaInk = 0xFF;
+
+static void alphaTable(uint8_t ink)
+{
+	if (ink == alphaInk)
+	{
+		return;
+	}
+	for (uint8_t a = 0; a < 16; a++)
+	{
+		for (uint8_t d = 0; d < 16; d++)
+		{
+			int16_t delta = ((int16_t)ink - d) * a;
+			alphaBlend[a][d] = d + (delta + (delta < 0 ? -7 : 7)) / 15;
+		}
+	}
+	alphaInk = ink;
+}
+
+// Coverage of glyph columns from .. from + n - 1 (scaled) into stageLine,
+// laid out like the buffer from a pixel of the given phase (0 for a high
+// nibble); columns past the glyph are 0.  Returns the bytes staged.
+static uint16_t stageAlpha(const uint8_t *row, uint8_t width, uint8_t scale, int16_t from, int16_t n, uint8_t phase)
+{
+	uint16_t bytes = (phase + n + 1) >> 1;
+	memset(stageLine, 0, bytes);
+
+	if (scale == 1 && phase == (from & 1))
+	{
+		// the glyph's nibbles already sit as in the buffer, copy whole bytes
+		int16_t end = min(from + n, (int)width);
+		if (end > from)
+		{
+			uint8_t last = ((end + 1) >> 1) - (from >> 1) - 1;
+			memcpy_P(stageLine, row + (from >> 1), last + 1);
+			if (from & 1)
+			{
+				stageLine[0] &= 0x0F;
+			}
+			if (end & 1)
+			{
+				stageLine[last] &= 0xF0;
+			}
+		}
+		return bytes;
+	}
+
+	for (int16_t i = 0; i < n; i++)
+	{
+		uint8_t c = (from + i) / scale;
+		if (c >= width)
+		{
+			break;
+		}
+		uint8_t a = alphaAt(row, c);
+		uint16_t p = phase + i;
+		stageLine[p >> 1] |= (p & 1) ? a : (a << 4);
+	}
+	return bytes;
+}
+
+// Staged coverage over a background of gray bg, two pixels a byte; the
+// masks keep the pixels either side of the span
+static void alphaSolid(uint8_t *pBuf, uint16_t n, uint8_t bg, uint8_t firstMask, uint8_t lastMask)
+{
+	for (uint16_t i = 0; i < n; i++)
+	{
+		uint8_t a = stageLine[i];
+		uint8_t v = (alphaBlend[a >> 4][bg] << 4) | alphaBlend[a & 0x0F][bg];
+		uint8_t m = 0xFF;
+		if (i == 0)
+		{
+			m &= firstMask;
+		}
+		if (i == n - 1)
+		{
+			m &= lastMask;
+		}
+		pBuf[i] = (pBuf[i] & ~m) | (v & m);
+	}
+}
+
+// Staged coverage over what the buffer holds, two pixels a byte; no
+// coverage leaves a pixel as it is
+static void alphaOver(uint8_t *pBuf, uint16_t n)
+{
+	for (uint16_t i = 0; i < n; i++)
+	{
+		uint8_t a = stageLine[i];
+		if (a)
+		{
+			uint8_t d = pBuf[i];
+			pBuf[i] = (alphaBlend[a >> 4][d >> 4] << 4) | alphaBlend[a & 0x0F][d & 0x0F];
+		}
+	}
+}
+#endif
+
+// Draw a glyph of 4 bit coverage.  In 4 bit mode each pixel blends from the
+// background (textbgcolor when opaque, else the buffer's) toward the ink
+// through a 16x16 table, two pixels a byte.  Raster ops and 1 bit mode draw
+// the pixels at least half covered as plain ink.
+void ESP8266_SSD1322::drawAlphaGlyph(uint32_t glyph, int x, int y, uint8_t width, uint8_t height, int8_t gap, boolean opaque)
+{
+	const uint8_t *row = (const uint8_t *)glyph;
+	uint8_t rowBytes = (width + 1) / 2;
+	uint8_t scale = textsize;
+	int16_t bgW = (width+gap)*scale;
+
+#ifdef SSD1322_256_64_4
+	if (rasterOp == SSD1322_ROP_NORMAL)
+	{
+		int16_t inkW = width*scale;
+		uint8_t bg = textbgcolor & 0x0F;
+		alphaTable(textcolor & 0x0F);
+
+		if (!flushRotation && rotation)
+		{
+			// the buffer is not in screen orientation, go pixel by pixel
+			int16_t cellW = max(inkW, bgW);
+			for (int16_t j = 0; j < height*scale; j++)
+			{
+				const uint8_t *p = row + (j / scale) * rowBytes;
+				for (int16_t i = 0; i < cellW; i++)
+				{
+					uint8_t a = (i < inkW) ? alphaAt(p, i / scale) : 0;
+					if (!a && !(opaque && i < bgW))
+					{
+						continue;
+					}
+
+					int16_t bx = x + i, by = y + j;
+					toBuffer(bx, by);
+					if (bx < 0 || by < 0 || bx >= bufWidth || by >= bufHeight)
+					{
+						continue;
+					}
+					uint8_t *pBuf = &buffer[(bx >> 1) + by * bufStride];
+					uint8_t sh = (bx & 1) ? 0 : 4;
+					uint8_t d = (opaque && i < bgW) ? bg : (*pBuf >> sh) & 0x0F;
+					*pBuf = (*pBuf & ~(0x0F << sh)) | (alphaBlend[a][d] << sh);
+				}
+			}
+			return;
+		}
+
+		// opaque to the advance, blended over the buffer past it (negative gap)
+		int16_t c0 = max(0, -x);
+		int16_t c1 = min((int)max(inkW, bgW), _width - x);
+		int16_t solid = opaque ? min(c1, bgW) : c0;
+		int16_t ink1 = min(c1, inkW);
+		int16_t from = max(c0, solid);
+
+		for (uint8_t i = 0; i < height; i++, row += rowBytes)
+		{
+			int16_t pY = y + i*scale;
+			if (pY >= _height)
+			{
+				break;
+			}
+			if (pY + scale <= 0)
+			{
+				continue;
+			}
+			int16_t k0 = max(0, -pY);
+			int16_t k1 = min((int)scale, _height - pY);
+
+			if (solid > c0)
+			{
+				int16_t bx = x + c0;
+				uint16_t n = stageAlpha(row, width, scale, c0, solid - c0, bx & 1);
+				uint8_t firstMask = (bx & 1) ? 0x0F : 0xFF;
+				uint8_t lastMask = ((bx + solid - c0) & 1) ? 0xF0 : 0xFF;
+				for (int16_t k = k0; k < k1; k++)
+				{
+					alphaSolid(&buffer[(bx >> 1) + (pY + k) * bufStride], n, bg, firstMask, lastMask);
+				}
+			}
+			if (ink1 > from)
+			{
+				int16_t bx = x + from;
+				uint16_t n = stageAlpha(row, width, scale, from, ink1 - from, bx & 1);
+				for (int16_t k = k0; k < k1; k++)
+				{
+					alphaOver(&buffer[(bx >> 1) + (pY + k) * bufStride], n);
+				}
+			}
+		}
+		return;
+	}
+#endif
+
+	uint8_t inkOp, inkSrc;
+	resolveRop(textcolor, inkOp, inkSrc);
+	if (opaque)
+	{
+		fillRect(x, y, bgW, height*scale, textbgcolor);
+	}
+
+	for (uint8_t i = 0; i < height; i++, row += rowBytes)
+	{
+		int16_t pY = y + i*scale;
+		if (pY >= _height)
+		{
+			break;
+		}
+
+		for (uint8_t c = 0; c < width; c++)
+		{
+			// a run of pixels at least half covered, then one that is not
+			uint8_t n = 0;
+			while (c + n < width && alphaAt(row, c + n) >= 8)
+			{
+				n++;
+			}
+			if (n)
+			{
+				for (uint8_t k = 0; k < scale; k++)
+				{
+					hspan(x + c*scale, pY + k, n*scale, inkOp, inkSrc);
+				}
+				c += n;
+			}
+		}
+	}
+}
+
+static const uint32_t powersOf10[10] = {
+  1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// The n lowest decimal digits of v, written backward before end; v keeps the
+// rest.  Dividing by the constant 10 compiles to a multiply and shift.
+static char *putDigits(char *end, uint32_t &v, uint8_t n)
+{
+  while (n--)
+  {
+    uint32_t q = v / 10;
+    *--end = '0' + (char)(v - q * 10);
+    v = q;
+  }
+  return end;
+}
+
+// A number as text at the end of buf (SSD1322_NUMBER_WIDTH + 1 bytes):
+// whole, then decimals digits of frac, whatever frac holds past them carried
+// into whole.  Padded on the left to width characters, zeros going after the
+// sign and anything else before it.
+static char *formatNumber(char *buf, boolean negative, uint32_t whole, uint32_t frac,
+                          uint8_t decimals, uint8_t width, char pad)
+{
+  char *end = buf + SSD1322_NUMBER_WIDTH;
+  char *p = end;
+
+  *p = 0;
+  if (decimals)
+  {
+    p = putDigits(p, frac, decimals);
+    *--p = '.';
+  }
+  whole += frac;
+  do
+  {
+    p = putDigits(p, whole, 1);
+  } while (whole);
+
+  width = min(width, (uint8_t)SSD1322_NUMBER_WIDTH);
+  char *start = end - width;
+  if (negative)
+  {
+    if (pad == '0')
+    {
+      start++;
+    }
+    else
+    {
+      *--p = '-';
+    }
+  }
+  while (p > start)
+  {
+    *--p = pad;
+  }
+  if (negative && pad == '0')
+  {
+    *--p = '-';
+  }
+  return p;
+}
+
+/***************************************************************************************
+** Function name:           drawNumber unsigned with size
+** Descriptions:            drawNumber
+***************************************************************************************/
+int ESP8266_SSD1322::drawNumber(long long_num,int poX, int poY, int size)
+{
+    return drawInt(long_num, poX, poY, size);
+}
+
+/***************************************************************************************
+** Function name:           drawInt
+** Descriptions:            draw an integer, padded on the left to width characters
+**                          with pad (' ' or '0'), without sprintf
+***************************************************************************************/
+int ESP8266_SSD1322::drawInt(long value, int x, int y, int size, uint8_t width, char pad)
+{
+    return drawFixed(value, 0, x, y, size, width, pad);
+}
+
+/***************************************************************************************
+** Function name:           drawFixed
+** Descriptions:            draw value / 10^decimals with decimals places, e.g.
+**                          drawFixed(2315, 2, ...) draws 23.15
+***************************************************************************************/
+int ESP8266_SSD1322::drawFixed(long value, uint8_t decimals, int x, int y, int size, uint8_t width, char pad)
+{
+    char tmp[SSD1322_NUMBER_WIDTH + 1];
+    return drawString(formatFixed(tmp, value, decimals, width, pad), x, y, size);
+}
+
+/**
+ * The text drawFixed() draws, for code that lays numbers out itself.
+ * @param buf - SSD1322_NUMBER_WIDTH + 1 bytes; the text ends at its end.
+ * @return where the text starts in buf.
+ */
+char *ESP8266_SSD1322::formatFixed(char *buf, long value, uint8_t decimals, uint8_t width, char pad)
+{
+    // the magnitude in unsigned arithmetic, so the most negative long works too
+    uint32_t magnitude = (value < 0) ? 0 - (uint32_t)value : (uint32_t)value;
+
+    decimals = min(decimals, (uint8_t)9);
+    return formatNumber(buf, value < 0, 0, magnitude, decimals, width, pad);
+}
+
+/***************************************************************************************
+** Function name:           drawChar
+** Descriptions:            draw char
+***************************************************************************************/
+int ESP8266_SSD1322::drawChar(char c, int x, int y, int size)
+{
+//Serial.println("drawChar:E");
+#ifdef LOAD_GLCD
+  // Use Adafruit font 5x7
+  if (size == 0)
+  {
+     setCursor(x, y);
+     return  print(c);
+  }
+#endif
+  int retVal = drawUnicode((uint8_t)c, x, y, size);
+//Serial.println("drawChar:X");
+  return retVal;
+}
+
+/***************************************************************************************
+** Function name:           drawString
+** Descriptions:            draw string
+***************************************************************************************/
+int ESP8266_SSD1322::drawString(const char *string, int poX, int poY, int size)
+{
+//Serial.println("drawString:E");
+#ifdef LOAD_GLCD
+	// Use Adafruit font 5x7
+   if (size == 0)
+   {
+	   setCursor(poX, poY);
+	   print(string);
+	   return 0;
+   }
+#endif
+    int sumX = 0;
+
+    while(*string)
+    {
+//Serial.print("ds:poX");
+//Serial.println(poX);
+        int xPlus = drawUnicode(utf8Next(string), poX, poY, size);
+        sumX += xPlus;
+        poX += xPlus;                            /* Move cursor right       */
+    }
+//Serial.print("drawString:x:");
+//Serial.println(sumX);
+    return sumX;
+}
+
+/***************************************************************************************
+** Function name:           drawCentreString
+** Descriptions:            draw string across centre
+***************************************************************************************/
+int ESP8266_SSD1322::drawCentreString(const char *string, int dX, int poY, int size)
+{
+    int len;
+    alignString(string, dX, poY, size, SSD1322_ALIGN_CENTRE, len);
+    return (size == 0) ? 0 : len;
+}
+
+/***************************************************************************************
+** Function name:           drawRightString
+** Descriptions:            draw string right justified
+***************************************************************************************/
+int ESP8266_SSD1322::drawRightString(const char *string, int dX, int poY, int size)
+{
+    int len;
+    alignString(string, dX, poY, size, SSD1322_ALIGN_RIGHT, len);
+    return (size == 0) ? 0 : len;
+}
+
+/***************************************************************************************
+** Function name:           measureString
+** Descriptions:            how far drawString() would move across, textsize included
+***************************************************************************************/
+int ESP8266_SSD1322::measureString(const char *string, int size)
+{
+#ifdef LOAD_GLCD
+    if (size == 0)
+    {
+        return strlen(string) * 6 * textsize;
+    }
+#endif
+    const SSD1322_Font *font = getFont(size);
+    int right;
+    return font ? stringWidth(font, string, right) * textsize : 0;
+}
+
+/***************************************************************************************
+** Function name:           drawAlignedString
+** Descriptions:            draw a string left, centre or right aligned on x and
+**                          return the box it covers on screen, for displayRect()
+***************************************************************************************/
+SSD1322_Rect ESP8266_SSD1322::drawAlignedString(const char *string, int x, int y, int size, uint8_t align)
+{
+    int len;
+    return alignString(string, x, y, size, align, len);
+}
+
+// drawAlignedString(), also giving the advance it measured in len
+SSD1322_Rect ESP8266_SSD1322::alignString(const char *string, int x, int y, int size, uint8_t align, int &len)
+{
+    SSD1322_Rect r = { 0, 0, 0, 0 };
+    int right, height;
+
+    len = 0;
+
+#ifdef LOAD_GLCD
+    if (size == 0)
+    {
+        // Adafruit font 5x7 in a 6x8 cell
+        len = right = strlen(string) * 6 * textsize;
+        height = 8 * textsize;
+    }
+    else
+#endif
+    {
+        const SSD1322_Font *font = getFont(size);
+        if (!font)
+        {
+            return r;
+        }
+        len = stringWidth(font, string, right) * textsize;
+        right *= textsize;
+        height = font->height * textsize;
+    }
+
+    if (align == SSD1322_ALIGN_CENTRE) x -= len / 2;
+    if (align == SSD1322_ALIGN_RIGHT) x -= len;
+    if (align != SSD1322_ALIGN_LEFT && x < 0) x = 0;
+
+    drawString(string, x, y, size);
+
+    // the part on screen
+    int x0 = max(x, 0), y0 = max(y, 0);
+    int x1 = min(x + right, (int)_width), y1 = min(y + height, (int)_height);
+    if (x0 < x1 && y0 < y1)
+    {
+        r.x = x0;
+        r.y = y0;
+        r.w = x1 - x0;
+        r.h = y1 - y0;
+    }
+    return r;
+}
+
+/***************************************************************************************
+** Function name:           drawFloat
+** Descriptions:            draw a float rounded to decimal places (0 to 9), in
+**                          one pass as drawFixed()
+***************************************************************************************/
+int ESP8266_SSD1322::drawFloat(float floatNumber, int decimal, int poX, int poY, int size, uint8_t width, char pad)
+{
+    char tmp[SSD1322_NUMBER_WIDTH + 1];
+    return drawString(formatFloat(tmp, floatNumber, decimal, width, pad), poX, poY, size);
+}
+
+/**
+ * The text drawFloat() draws, see formatFixed().
+ */
+char *ESP8266_SSD1322::formatFloat(char *buf, float value, int decimals, uint8_t width, char pad)
+{
+    boolean negative = value < 0;
+    uint32_t whole, frac = 0;
+
+    decimals = constrain(decimals, 0, 9);
+    if (negative)
+    {
+        value = -value;
+    }
+
+    if (value < 4294967040.0f)   // the largest float below 2^32
+    {
+        whole = (uint32_t)value;
+        // rounding up to a whole powersOf10[decimals] carries into whole
+        frac = (uint32_t)((value - whole) * powersOf10[decimals] + 0.5f);
+    }
+    else
+    {
+        whole = 0xFFFFFFFF;
+    }
+
+    // no minus sign on a number that rounds to 0
+    if (!whole && !frac)
+    {
+        negative = false;
+    }
+    return formatNumber(buf, negative, whole, frac, decimals, width, pad);
+}
+
+// One page of a page format bitmap turned row major, up to 255 columns
+static uint8_t pageStrip[8 * 32];
+
+// Ultra fast bitmap drawing, for bitmaps in the SSD1306 page format: a byte
+// is a column of 8 pixels, LSB at the top, and each band of 8 rows (a page)
+// is w such bytes.  The visible columns of a page are turned row major 8 at a
+// time with an 8x8 transpose, then the strip goes through the blitter, so any
+// position works and everything is clipped.  Set bits take color, clear bits
+// are left alone (the other way round with invert).  h need not be a multiple
+// of 8, the last page is then partly used.
+void ESP8266_SSD1322::ultraFastDrawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w, uint8_t h, uint8_t color, bool invert)
+{
+	// columns that can show, starting on a block of 8
+	int16_t c0 = (x < 0) ? ((-x) & ~7) : 0;
+	int16_t c1 = min((int16_t)w, (int16_t)(_width - x));
+	if (c0 >= c1)
+	{
+		return;
+	}
+	uint8_t stride = (c1 - c0 + 7) >> 3;
+
+	for (uint8_t page = 0; page * 8 < h; page++)
+	{
+		int16_t top = y + page * 8;
+		uint8_t rows = min(8, h - page * 8);
+
+		if (top + rows <= 0)
+		{
+			continue;
+		}
+		if (top >= _height)
+		{
+			break;
+		}
+
+		const uint8_t *pPage = bitmap + page * w;
+		for (int16_t c = c0; c < c1; c += 8)
+		{
+			uint8_t block[8];
+			for (uint8_t i = 0; i < 8; i++)
+			{
+				block[i] = (c + i < w) ? pgm_read_byte(pPage + c + i) : 0;
+				if (invert)
+					block[i] = ~block[i];
+			}
+
+			// block[7 - k] is now row k, MSB left
+			transpose8(block, block);
+			for (uint8_t k = 0; k < rows; k++)
+			{
+				pageStrip[k * stride + ((c - c0) >> 3)] = block[7 - k];
+			}
+		}
+
+#ifdef SSD1322_256_64_4
+		drawMonoBitmap4(x + c0, top, pageStrip, c1 - c0, rows, color, SSD1322_TRANSPARENT, SSD1322_BLIT_RAM);
+#else
+		blit(x + c0, top, pageStrip, c1 - c0, rows, color, SSD1322_BLIT_MASKED | SSD1322_BLIT_RAM);
+#endif
+	}
+}
+
+// Size of an RLE bitmap, false if it is not for this pixel format
+static boolean rleHeader(const uint8_t *rle, boolean ram, int16_t &w, int16_t &h)
+{
+	uint8_t head[SSD1322_RLE_HEADER];
+
+	if (ram)
+		memcpy(head, rle, sizeof(head));
+	else
+		memcpy_P(head, rle, sizeof(head));
+
+	w = head[1] | (head[2] << 8);
+	h = head[3] | (head[4] << 8);
+	return (head[0] == SSD1322_BITS_PER_PIXEL) && (w > 0) && (h > 0);
+}
+
+// Decode the n bytes of one PackBits row.  A control byte c below 128 is
+// followed by c + 1 literal bytes, above 128 by one byte repeated 257 - c
+// times; 128 is padding.  Bytes from .. from + count - 1 of the row land in
+// dst, the rest is only skipped.  Returns the start of the next row.
+static const uint8_t *rleRow(const uint8_t *p, boolean ram, uint16_t n, uint8_t *dst, uint16_t from, uint16_t count)
+{
+	uint16_t to = from + count;
+	uint16_t i = 0;
+
+	while (i < n)
+	{
+		uint8_t c = ram ? *p : pgm_read_byte(p);
+		p++;
+		if (c == 128)
+		{
+			continue;
+		}
+
+		uint16_t len = (c < 128) ? c + 1 : 257 - c;
+		if (len > n - i)
+		{
+			// bad data, stay inside the row
+			len = n - i;
+		}
+		uint16_t a = max(i, from);
+		uint16_t b = min((uint16_t)(i + len), to);
+
+		if (c < 128)
+		{
+			if (a < b)
+			{
+				if (ram)
+					memcpy(dst + a - from, p + a - i, b - a);
+				else
+					memcpy_P(dst + a - from, p + a - i, b - a);
+			}
+			p += c + 1;
+		}
+		else
+		{
+			uint8_t v = ram ? *p : pgm_read_byte(p);
+			p++;
+			if (a < b)
+			{
+				memset(dst + a - from, v, b - a);
+			}
+		}
+		i += len;
+	}
+	return p;
+}
+
+/**
+ * Draw a run length encoded bitmap made by extras/tools/ssd1322_convert -r.  The data
+ * starts with a SSD1322_RLE_HEADER byte header (bits per pixel, then width and
+ * height, 16 bit little endian) followed by one PackBits run list per row of
+ * the bitmap in the buffer's pixel format.  Runs of equal bytes are memset
+ * straight into the buffer when the bitmap is opaque, whole bytes wide, lined
+ * up on a byte and fully on screen across; anything else goes through the
+ * blitter one row at a time, clipped and under the current raster op.
+ * @param color, flags - as for blit(); SSD1322_BLIT_RAM for data in RAM.
+ * @return false if the data is for the other pixel format.
+ */
+boolean ESP8266_SSD1322::drawRLEBitmap(int16_t x, int16_t y, const uint8_t *rle, uint16_t color, uint8_t flags)
+{
+	boolean ram = (flags & SSD1322_BLIT_RAM) != 0;
+	int16_t w, h;
+	uint8_t op, src;
+
+	if (!rleHeader(rle, ram, w, h))
+	{
+		return false;
+	}
+
+	const uint8_t *p = rle + SSD1322_RLE_HEADER;
+	uint16_t stride = ((uint32_t)w * SSD1322_BITS_PER_PIXEL + 7) >> 3;
+
+	// rows and columns that show
+	int16_t j0 = max((int16_t)0, (int16_t)-y);
+	int16_t j1 = min(h, (int16_t)(_height - y));
+	int16_t i0 = max((int16_t)0, (int16_t)-x);
+	int16_t i1 = min(w, (int16_t)(_width - x));
+	if (j0 >= j1 || i0 >= i1)
+	{
+		return true;
+	}
+
+	resolveRop(color, op, src);
+	boolean direct = (flushRotation || !rotation) && (flags & SSD1322_BLIT_OPAQUE) &&
+			op == SSD1322_ROP_COPY && i0 == 0 && i1 == w &&
+			((x * SSD1322_BITS_PER_PIXEL) & 7) == 0 && ((w * SSD1322_BITS_PER_PIXEL) & 7) == 0;
+
+	// the source bytes that hold the visible columns
+	uint16_t b0 = ((uint32_t)i0 * SSD1322_BITS_PER_PIXEL) >> 3;
+	uint16_t b1 = ((uint32_t)i1 * SSD1322_BITS_PER_PIXEL + 7) >> 3;
+	int16_t sx = i0 - b0 * (8 / SSD1322_BITS_PER_PIXEL);
+
+	for (int16_t j = 0; j < j1; j++)
+	{
+		if (j < j0)
+		{
+			p = rleRow(p, ram, stride, NULL, 0, 0);
+		}
+		else if (direct)
+		{
+			uint8_t *pBuf = &buffer[((x * SSD1322_BITS_PER_PIXEL) >> 3) + (y + j) * bufStride];
+			p = rleRow(p, ram, stride, pBuf, 0, stride);
+		}
+		else
+		{
+			p = rleRow(p, ram, stride, stageLine, b0, b1 - b0);
+			blitRect(x + i0, y + j, stageLine, b1 - b0, sx, i1 - i0, 1, color,
+					(flags & SSD1322_BLIT_OPAQUE) | SSD1322_BLIT_RAM);
+		}
+	}
+	return true;
+}
+
+/**
+ * Decode an RLE bitmap straight into the display RAM, leaving the buffer
+ * alone; the next display() covers it again.  x, y are panel coordinates,
+ * rotation does not apply.  x and the width must be multiples of 4 (the
+ * controller's column unit) and the bitmap must fit on the panel.
+ * @param flags - SSD1322_BLIT_RAM for data in RAM.
+ * @return false if the bitmap does not fit or is for the other pixel format.
+ */
+boolean ESP8266_SSD1322::displayRLEBitmap(int16_t x, int16_t y, const uint8_t *rle, uint8_t flags)
+{
+	boolean ram = (flags & SSD1322_BLIT_RAM) != 0;
+	int16_t w, h;
+
+	if (!rleHeader(rle, ram, w, h))
+	{
+		return false;
+	}
+	if ((x & 3) || (w & 3) || x < 0 || y < 0 || w > SSD1322_LCDWIDTH - x || h > SSD1322_LCDHEIGHT - y)
+	{
+		return false;
+	}
+
+	const uint8_t *p = rle + SSD1322_RLE_HEADER;
+	uint16_t stride = (w * SSD1322_BITS_PER_PIXEL + 7) >> 3;
+
+	// panel coordinates, so not through a 180 degree remap left by display()
+	setRemap(false);
+
+	ssd1322_command(SSD1322_SETCOLUMNADDR);
+	ssd1322_data(MIN_SEG + (x >> 2));
+	ssd1322_data(MIN_SEG + ((x + w) >> 2) - 1);
+
+	ssd1322_command(SSD1322_SETROWADDR);
+	ssd1322_data(y);
+	ssd1322_data(y + h - 1);
+
+	ssd1322_command(SSD1322_WRITERAM);
+
+	for (int16_t j = 0; j < h; j++)
+	{
+		p = rleRow(p, ram, stride, stageLine, 0, stride);
+#ifdef SSD1322_256_64_4
+		ssd1322_dataBytes(stageLine, stride);
+#endif
+#ifdef SSD1322_256_64_1
+		uint8_t destArray[SSD1322_LCDWIDTH / 2];
+
+		expandMono(stageLine, destArray, stride);
+		ssd1322_dataBytes(destArray, w >> 1);
+#endif
 	}
-//Serial.println("drawUnicode:X");
-	return (width+gap)*textsize;        // x +
+	return true;
 }
 
-/***************************************************************************************
-** Function name:           drawNumber unsigned with size
-** Descriptions:            drawNumber
-***************************************************************************************/
-int ESP8266_SSD1322::drawNumber(long long_num,int poX, int poY, int size)
+// Floyd-Steinberg errors carried to the next row, in 1/16 gray steps
+static int16_t ditherErr[SSD1322_LCDWIDTH + 2];
+
+// n / 17 without a divide, exact for n < 4096: 8 bit gray to 4 bit levels
+static inline uint8_t div17(uint16_t n)
 {
-    char tmp[10];
-    if (long_num < 0) sprintf(tmp, "%li", long_num);
-    else sprintf(tmp, "%lu", long_num);
-    return drawString(tmp, poX, poY, size);
+  return ((uint32_t)n * 241) >> 12;
 }
 
-/***************************************************************************************
-** Function name:           drawChar
-** Descriptions:            draw char
-***************************************************************************************/
-int ESP8266_SSD1322::drawChar(char c, int x, int y, int size)
+#ifdef SSD1322_256_64_4
+// 4x4 Bayer matrix scaled to the 17 gray steps between two levels
+static const uint8_t bayerGray[4][4] = {
+  {  0,  8,  2, 10 },
+  { 12,  4, 14,  6 },
+  {  3, 11,  1,  9 },
+  { 15,  7, 13,  5 }
+};
+
+static void grayRowNearest(uint8_t *dst, const uint8_t *src, int16_t n, int16_t /* sx */, int16_t /* sy */)
 {
-//Serial.println("drawChar:E");
-#ifdef LOAD_GLCD
-  // Use Adafruit font 5x7
-  if (size == 0)
+  for (; n >= 2; n -= 2, src += 2)
   {
-     setCursor(x, y);
-     return  print(c);
+    *dst++ = (div17(src[0] + 8) << 4) | div17(src[1] + 8);
+  }
+  if (n)
+  {
+    *dst = div17(src[0] + 8) << 4;
   }
-#endif
-  int retVal = drawUnicode(c, x, y, size);
-//Serial.println("drawChar:X");
-  return retVal;
 }
 
-/***************************************************************************************
-** Function name:           drawString
-** Descriptions:            draw string
-***************************************************************************************/
-int ESP8266_SSD1322::drawString(char *string, int poX, int poY, int size)
+static void grayRowBayer(uint8_t *dst, const uint8_t *src, int16_t n, int16_t sx, int16_t sy)
 {
-//Serial.println("drawString:E");
-#ifdef LOAD_GLCD
-	// Use Adafruit font 5x7
-   if (size == 0)
-   {
-	   setCursor(poX, poY);
-	   print(string);
-	   return 0;
-   }
-#endif
-    int sumX = 0;
+  const uint8_t *t = bayerGray[sy & 3];
 
-    while(*string)
-    {
-//Serial.print("ds:poX");
-//Serial.println(poX);
-        int xPlus = drawChar(*string, poX, poY, size);
-        sumX += xPlus;
-        string++;
-        poX += xPlus;                            /* Move cursor right       */
-    }
-//Serial.print("drawString:x:");
-//Serial.println(sumX);
-    return sumX;
+  for (; n >= 2; n -= 2, src += 2, sx += 2)
+  {
+    *dst++ = (div17(src[0] + t[sx & 3] + 1) << 4) | div17(src[1] + t[(sx + 1) & 3] + 1);
+  }
+  if (n)
+  {
+    *dst = div17(src[0] + t[sx & 3] + 1) << 4;
+  }
 }
-
-/***************************************************************************************
-** Function name:           drawCentreString
-** Descriptions:            draw string across centre
-***************************************************************************************/
-int ESP8266_SSD1322::drawCentreString(char *string, int dX, int poY, int size)
+#else
+// 8x8 Bayer matrix, thresholds 4 gray steps apart
+static const uint8_t bayerGray[8][8] = {
+  {  0, 32,  8, 40,  2, 34, 10, 42 },
+  { 48, 16, 56, 24, 50, 18, 58, 26 },
+  { 12, 44,  4, 36, 14, 46,  6, 38 },
+  { 60, 28, 52, 20, 62, 30, 54, 22 },
+  {  3, 35, 11, 43,  1, 33,  9, 41 },
+  { 51, 19, 59, 27, 49, 17, 57, 25 },
+  { 15, 47,  7, 39, 13, 45,  5, 37 },
+  { 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+
+static void grayRowNearest(uint8_t *dst, const uint8_t *src, int16_t n, int16_t /* sx */, int16_t /* sy */)
 {
-#ifdef LOAD_GLCD
-	// Use Adafruit font fixed 5x7
-   if (size == 0)
-   {
-	   int len = strlen(string) * (5 + 1);
-	   int poX = dX - len / 2;
-	   setCursor(poX, poY);
-	   print(string);
-	   return 0;
-   }
-#endif
-
-    int sumX = 0;
-    int len = 0;
-    char *pointer = string;
-    char ascii;
+  uint8_t b = 0;
+  uint8_t bit = 0x80;
 
-    while(*pointer)
+  while (n--)
+  {
+    if (*src++ >= 128)
+      b |= bit;
+    bit >>= 1;
+    if (!bit)
     {
-        ascii = *pointer;
-        //if (size==0)len += 1+pgm_read_byte((uint8_t *)widtbl_log+ascii);
-        //if (size==1)len += 1+pgm_read_byte((uint8_t *)widtbl_f8+ascii-32);
-#ifdef LOAD_FONT2
-        if (size==2)len += 1+pgm_read_byte((uint8_t *)widtbl_f16+ascii-32);
-#endif
-        //if (size==3)len += 1+pgm_read_byte((uint8_t *)widtbl_f48+ascii-32)/2;
-#ifdef LOAD_FONT4
-        if (size==4)len += pgm_read_byte((uint8_t *)widtbl_f32+ascii-32)-3;
-#endif
-        //if (size==5) len += pgm_read_byte((uint8_t *)widtbl_f48+ascii-32)-3;
-#ifdef LOAD_FONT6
-        if (size==6) len += pgm_read_byte((uint8_t *)widtbl_f64+ascii-32)-3;
-#endif
-#ifdef LOAD_FONT7
-        if (size==7) len += pgm_read_byte((uint8_t *)widtbl_f7s+ascii-32)+2;
-#endif
-#ifdef LOAD_FONT8
-        if (size==8) len += pgm_read_byte((uint8_t *)widtbl_F10+ascii-32)+gap_F10;
-#endif
-        pointer++;
+      *dst++ = b;
+      b = 0;
+      bit = 0x80;
     }
-    len = len*textsize;
-    int poX = dX - len/2;
+  }
+  if (bit != 0x80)
+  {
+    *dst = b;
+  }
+}
 
-    if (poX < 0) poX = 0;
+static void grayRowBayer(uint8_t *dst, const uint8_t *src, int16_t n, int16_t sx, int16_t sy)
+{
+  const uint8_t *t = bayerGray[sy & 7];
+  uint8_t b = 0;
+  uint8_t bit = 0x80;
 
-    while(*string)
+  while (n--)
+  {
+    if (*src++ > t[sx++ & 7] * 4 + 2)
+      b |= bit;
+    bit >>= 1;
+    if (!bit)
     {
-
-        int xPlus = drawChar(*string, poX, poY, size);
-        sumX += xPlus;
-        string++;
-        poX += xPlus;                  /* Move cursor right            */
+      *dst++ = b;
+      b = 0;
+      bit = 0x80;
     }
-
-    return sumX;
+  }
+  if (bit != 0x80)
+  {
+    *dst = b;
+  }
 }
+#endif
 
-/***************************************************************************************
-** Function name:           drawRightString
-** Descriptions:            draw string right justified
-***************************************************************************************/
-int ESP8266_SSD1322::drawRightString(char *string, int dX, int poY, int size)
+// Floyd-Steinberg with one row of errors: ditherErr[i + 1] holds the error
+// for pixel i of this row until it is read, then the one for the next row.
+// Values are gray * 16, a level is 4080 / (number of levels - 1) of them.
+static void grayRowDiffuse(uint8_t *dst, const uint8_t *src, int16_t n, int16_t /* sx */, int16_t /* sy */)
 {
-    int sumX = 0;
-    int len = 0;
-    char *pointer = string;
-    char ascii;
+  int16_t *err = ditherErr;
+  int16_t right = 0;	// 7/16 for the next pixel
+  int16_t downRight = 0;	// 1/16 for the pixel below the next one
+#ifdef SSD1322_256_64_4
+  uint8_t hi = 0;
+#else
+  uint8_t b = 0;
+  uint8_t bit = 0x80;
+#endif
+
+  for (int16_t i = 0; i < n; i++)
+  {
+    int16_t v = (src[i] << 4) + right + err[i + 1];
+    if (v < 0) v = 0;
+    if (v > 4080) v = 4080;
+
+#ifdef SSD1322_256_64_4
+    // v / 272, exact over the clamped range
+    uint8_t q = ((uint32_t)(v + 136) * 241) >> 16;
+    int16_t e = v - q * 272;
+
+    if (i & 1)
+      *dst++ = hi | q;
+    else
+      hi = q << 4;
+#else
+    boolean q = v >= 2040;
+    int16_t e = q ? v - 4080 : v;
 
-    while(*pointer)
+    if (q)
+      b |= bit;
+    bit >>= 1;
+    if (!bit)
     {
-        ascii = *pointer;
-        //if (size==0)len += 1+pgm_read_byte((uint8_t *)widtbl_log+ascii);
-        //if (size==1)len += 1+pgm_read_byte((uint8_t *)widtbl_f8+ascii-32);
-#ifdef LOAD_FONT2
-        if (size==2)len += 1+pgm_read_byte((uint8_t *)widtbl_f16+ascii-32);
-#endif
-        //if (size==3)len += 1+pgm_read_byte((uint8_t *)widtbl_f48+ascii-32)/2;
-#ifdef LOAD_FONT4
-        if (size==4)len += pgm_read_byte((uint8_t *)widtbl_f32+ascii-32)-3;
-#endif
-        //if (size==5) len += pgm_read_byte((uint8_t *)widtbl_f48+ascii-32)-3;
-#ifdef LOAD_FONT6
-        if (size==6) len += pgm_read_byte((uint8_t *)widtbl_f64+ascii-32)-3;
-#endif
-#ifdef LOAD_FONT7
-        if (size==7) len += pgm_read_byte((uint8_t *)widtbl_f7s+ascii-32)+2;
+      *dst++ = b;
+      b = 0;
+      bit = 0x80;
+    }
 #endif
-#ifdef LOAD_FONT8
-        if (size==8) len += pgm_read_byte((uint8_t *)widtbl_F10+ascii-32)+gap_F10;
+
+    right = (e * 7) >> 4;
+    err[i] += (e * 3) >> 4;
+    err[i + 1] = ((e * 5) >> 4) + downRight;
+    downRight = e >> 4;
+  }
+
+#ifdef SSD1322_256_64_4
+  if (n & 1)
+    *dst = hi;
+#else
+  if (bit != 0x80)
+    *dst = b;
 #endif
-        pointer++;
-    }
+}
 
-    len = len*textsize;
-    int poX = dX - len;
+typedef void (*GrayRowFn)(uint8_t *dst, const uint8_t *src, int16_t n, int16_t sx, int16_t sy);
 
-    if (poX < 0) poX = 0;
+/**
+ * Draw an 8 bit grayscale image (a camera frame, a heat map) quantised to the
+ * buffer's levels, clipped, under the current raster op.  Each row is turned
+ * into buffer format in integer arithmetic, 2 pixels per byte in 4 bit mode,
+ * then blitted.  The ordered dither is anchored to the screen so it holds
+ * still while the image changes.
+ * @param pixels - w x h gray levels in RAM, 0 black to 255 white, row by row.
+ * @param mode - SSD1322_DITHER_NONE, SSD1322_DITHER_BAYER or SSD1322_DITHER_FS.
+ */
+void ESP8266_SSD1322::drawGray8(int16_t x, int16_t y, const uint8_t *pixels, int16_t w, int16_t h, uint8_t mode)
+{
+	int16_t i0 = max((int16_t)0, (int16_t)-x);
+	int16_t i1 = min(w, (int16_t)(_width - x));
+	int16_t j0 = max((int16_t)0, (int16_t)-y);
+	int16_t j1 = min(h, (int16_t)(_height - y));
+	if (i0 >= i1 || j0 >= j1)
+	{
+		return;
+	}
 
-    while(*string)
-    {
+	int16_t n = i1 - i0;
+	uint16_t stride = (n * SSD1322_BITS_PER_PIXEL + 7) >> 3;
+	GrayRowFn row = grayRowNearest;
 
-        int xPlus = drawChar(*string, poX, poY, size);
-        sumX += xPlus;
-        string++;
-        poX += xPlus;          /* Move cursor right            */
-    }
+	if (mode == SSD1322_DITHER_BAYER)
+	{
+		row = grayRowBayer;
+	}
+	else if (mode == SSD1322_DITHER_FS)
+	{
+		row = grayRowDiffuse;
+		memset(ditherErr, 0, (n + 2) * sizeof(ditherErr[0]));
+	}
 
-    return sumX;
+	for (int16_t j = j0; j < j1; j++)
+	{
+		row(stageLine, pixels + (uint32_t)j * w + i0, n, x + i0, y + j);
+		blitRect(x + i0, y + j, stageLine, stride, 0, n, 1, WHITE, SSD1322_BLIT_OPAQUE | SSD1322_BLIT_RAM);
+	}
 }
 
-/***************************************************************************************
-** Function name:           drawFloat
-** Descriptions:            drawFloat
-***************************************************************************************/
-int ESP8266_SSD1322::drawFloat(float floatNumber, int decimal, int poX, int poY, int size)
+// Pixel i of a 1, 4 or 8 bit source row as 8 bit gray
+static inline uint8_t sourceGray(const uint8_t *row, uint16_t i, uint8_t bpp, boolean ram)
 {
-    unsigned long temp=0;
-    float decy=0.0;
-    float rounding = 0.5;
+  const uint8_t *p = row + ((i * bpp) >> 3);
+  uint8_t b = ram ? *p : pgm_read_byte(p);
+
+  if (bpp == 8)
+    return b;
+  if (bpp == 4)
+    return ((i & 1) ? (b & 0x0F) : (b >> 4)) * 17;
+  return (b & (0x80 >> (i & 7))) ? 255 : 0;
+}
 
-    float eep = 0.000001;
+// Append one 8 bit gray pixel to a row in buffer format
+#ifdef SSD1322_256_64_4
+#define SCALE_PUT(g) \
+  do { \
+    uint8_t q = div17((g) + 8); \
+    if (k & 1) *dst++ |= q; else *dst = q << 4; \
+    k++; \
+  } while (0)
+#else
+#define SCALE_PUT(g) \
+  do { \
+    if (!(k & 7)) *dst = 0; \
+    if ((g) >= 128) *dst |= 0x80 >> (k & 7); \
+    if (!(++k & 7)) dst++; \
+  } while (0)
+#endif
 
-    int sumX    = 0;
-    int xPlus   = 0;
+/**
+ * Draw a bitmap stretched or shrunk to dw x dh pixels, clipped, under the
+ * current raster op.  Source positions step in 16.16 fixed point from pixel
+ * centre to pixel centre, and each destination row is built whole and
+ * blitted.  Nearest sampling reuses a row while the source row stays the
+ * same; SSD1322_BLIT_BILINEAR blends the 4 nearest source pixels.
+ * @param bitmap - sw x sh pixels of bpp bits (1 MSB left, 4 high nibble
+ * left, or 8 bit gray), rows padded to whole bytes, in PROGMEM unless
+ * SSD1322_BLIT_RAM is given.
+ * @param color, flags - as for blit(); with SSD1322_BLIT_MASKED every pixel
+ * that comes out above black takes the colour.
+ */
+void ESP8266_SSD1322::drawBitmapScaled(int16_t x, int16_t y, const uint8_t *bitmap, int16_t sw, int16_t sh, uint8_t bpp,
+		int16_t dw, int16_t dh, uint16_t color, uint8_t flags)
+{
+	if (sw <= 0 || sh <= 0 || dw <= 0 || dh <= 0 || (bpp != 1 && bpp != 4 && bpp != 8))
+	{
+		return;
+	}
 
-    if(floatNumber-0.0 < eep)       // floatNumber < 0
-    {
-        xPlus = drawChar('-',poX, poY, size);
-        floatNumber = -floatNumber;
+	// the destination pixels that show
+	int16_t i0 = max((int16_t)0, (int16_t)-x);
+	int16_t i1 = min(dw, (int16_t)(_width - x));
+	int16_t j0 = max((int16_t)0, (int16_t)-y);
+	int16_t j1 = min(dh, (int16_t)(_height - y));
+	if (i0 >= i1 || j0 >= j1)
+	{
+		return;
+	}
 
-        poX  += xPlus;
-        sumX += xPlus;
-    }
+	boolean ram = (flags & SSD1322_BLIT_RAM) != 0;
+	boolean bilinear = (flags & SSD1322_BLIT_BILINEAR) != 0;
+	uint8_t blitFlags = (flags & SSD1322_BLIT_OPAQUE) | SSD1322_BLIT_RAM;
+	uint16_t srcStride = ((uint32_t)sw * bpp + 7) >> 3;
+	int16_t n = i1 - i0;
+	uint16_t stride = (n * SSD1322_BITS_PER_PIXEL + 7) >> 3;
+
+	// 16.16 source step per destination pixel and the centre of the first one
+	int32_t stepX = ((int32_t)sw << 16) / dw;
+	int32_t stepY = ((int32_t)sh << 16) / dh;
+	int32_t fx0 = i0 * stepX + (stepX >> 1);
+	int32_t fy = j0 * stepY + (stepY >> 1);
+	if (bilinear)
+	{
+		// sample between the centres of the source pixels
+		fx0 -= 0x8000;
+		fy -= 0x8000;
+	}
 
-    for (unsigned char i=0; i<decimal; ++i)
-    {
-        rounding /= 10.0;
-    }
+	int32_t lastRow = -1;
+	for (int16_t j = j0; j < j1; j++, fy += stepY)
+	{
+		uint8_t *dst = stageLine;
+		int32_t fx = fx0;
+		uint16_t k = 0;
 
-    floatNumber += rounding;
+		if (!bilinear)
+		{
+			int32_t sy = fy >> 16;
+			if (sy != lastRow)
+			{
+				const uint8_t *row = bitmap + sy * srcStride;
+				for (int16_t i = 0; i < n; i++, fx += stepX)
+				{
+					SCALE_PUT(sourceGray(row, fx >> 16, bpp, ram));
+				}
+				lastRow = sy;
+			}
+		}
+		else
+		{
+			// the two source rows around fy and the weight of the lower one
+			int32_t sy = fy >> 16;
+			uint16_t wy = (fy >> 8) & 0xFF;
+			if (fy < 0)
+			{
+				sy = 0;
+				wy = 0;
+			}
+			const uint8_t *row0 = bitmap + sy * srcStride;
+			const uint8_t *row1 = (sy + 1 < sh) ? row0 + srcStride : row0;
 
-    temp = (long)floatNumber;
+			for (int16_t i = 0; i < n; i++, fx += stepX)
+			{
+				int32_t sx = fx >> 16;
+				uint16_t wx = (fx >> 8) & 0xFF;
+				if (fx < 0)
+				{
+					sx = 0;
+					wx = 0;
+				}
+				int32_t sx1 = (sx + 1 < sw) ? sx + 1 : sx;
 
+				uint32_t top = sourceGray(row0, sx, bpp, ram) * (256 - wx) + sourceGray(row0, sx1, bpp, ram) * wx;
+				uint32_t bottom = sourceGray(row1, sx, bpp, ram) * (256 - wx) + sourceGray(row1, sx1, bpp, ram) * wx;
+				uint8_t g = (top * (256 - wy) + bottom * wy + 0x8000) >> 16;
+				SCALE_PUT(g);
+			}
+		}
 
-    xPlus = drawNumber(temp,poX, poY, size);
+		blitRect(x + i0, y + j, stageLine, stride, 0, n, 1, color, blitFlags);
+	}
+}
+#undef SCALE_PUT
 
-    poX  += xPlus;
-    sumX += xPlus;
+#ifdef SSD1322_256_64_4
+// Sub-frame rank of each step of the FRC cycle, bit reversed so the frames
+// that show a pixel one level up are spread out in time
+static uint8_t frcOrder[16];
 
-    if(decimal>0)
-    {
-        xPlus = drawChar('.',poX, poY, size);
-        poX += xPlus;                            /* Move cursor right            */
-        sumX += xPlus;
-    }
-    else
-    {
-        return sumX;
-    }
+/**
+ * Start temporal dithering (frame rate control).  image holds one byte per
+ * panel pixel, 256 x 64 row by row in panel orientation, with bits bits of
+ * gray (5 to 8).  Each sub-frame shows every pixel at its top 4 bits, one
+ * level up in the share of sub-frames given by the bits below, so over a
+ * cycle of 2^(bits - 4) sub-frames the panel averages to the levels in
+ * between (values past 15 and a fraction stay at 15).
+ * The buffer holds the sub-frame on screen while this runs; do not draw into
+ * it, draw into image.  Call frcUpdate() as often as possible.
+ * Not with flush rotation at 90 or 270 degrees, where the buffer is laid out
+ * 64 x 256; at 180 degrees the image still shows in panel orientation.
+ * @param rate - sub-frames per second to aim for, 0 for as many as possible.
+ * @return false for an unsupported depth or flush rotation.
+ */
+boolean ESP8266_SSD1322::beginFRC(const uint8_t *image, uint8_t bits, uint16_t rate)
+{
+	if (bits < 5 || bits > 8 || (flushRotation && (rotation & 1)))
+	{
+		return false;
+	}
 
-    decy = floatNumber - temp;
-    for(unsigned char i=0; i<decimal; i++)
-    {
-        decy *= 10;                                /* for the next decimal         */
-        temp = decy;                               /* get the decimal              */
-        xPlus = drawNumber(temp,poX, poY, size);
+	// image is in panel orientation
+	setRemap(false);
 
-        poX += xPlus;                              /* Move cursor right            */
-        sumX += xPlus;
-        decy -= temp;
-    }
-    return sumX;
+	uint8_t shift = bits - 4;
+	for (uint8_t t = 0; t < 16; t++)
+	{
+		uint8_t r = 0;
+		for (uint8_t b = 0; b < shift; b++)
+		{
+			if (t & (1 << b))
+				r |= 1 << (shift - 1 - b);
+		}
+		frcOrder[t] = r;
+	}
+
+	frcImage = image;
+	frcBits = bits;
+	frcPhase = 0;
+	frcInterval = rate ? 1000000UL / rate : 0;
+	frcFull = true;
+	memset(&frcStat, 0, sizeof(frcStat));
+	frcLast = frcWindow = micros();
+	frcWindowFrames = 0;
+	return true;
 }
 
-inline static byte readPixels(const byte* loc, bool invert)
+// Stop temporal dithering; the buffer keeps the last sub-frame
+void ESP8266_SSD1322::endFRC(void)
 {
-	byte pixels = pgm_read_byte((uint8_t *)loc);
-	if(invert)
-	pixels = ~pixels;
-	return pixels;
+	frcImage = NULL;
 }
 
-// Ultra fast bitmap drawing
-// Only downside is that height must be a multiple of 8, otherwise it gets rounded down to the nearest multiple of 8
-// Drawing bitmaps that are completely on-screen and have a Y co-ordinate that is a multiple of 8 results in best performance
-// PS - Sorry about the poorly named variables ;_;
-// Optimize: Use a local variable temp buffer then apply to global variable OLED buffer?
-void ESP8266_SSD1322::ultraFastDrawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w, uint8_t h, uint8_t color, bool invert)
-//void ESP8266_SSD1322::ultraFastDrawBitmap(s_image* image)
+SSD1322_FrcStats ESP8266_SSD1322::getFrcStats(void)
 {
-//	byte x = x;
-	byte yy = y;
-//	const byte* bitmap = bitmap;
-//	byte w = image->width;
-//	byte h = image->height;
-	//	byte colour = image->foreColour;
-//	bool invert = image->invert;
-	//	byte offsetY = image->offsetY;
-	byte offsetY = 0;
-
-	// Apply animation offset
-	//	yy += animation_offsetY();
+	return frcStat;
+}
 
-	//
-//	byte y = yy - offsetY;
+/**
+ * Flush the next FRC sub-frame when it is due.  Each row is worked out
+ * against the buffer, which holds what the panel shows, and only the column
+ * span that changed goes out; neighbouring changed rows share one window.
+ * @return true if a sub-frame went out.
+ */
+boolean ESP8266_SSD1322::frcUpdate(void)
+{
+	if (!frcImage)
+	{
+		return false;
+	}
 
-	//
-	byte h2 = h / 8;
+	uint32_t now = micros();
+	if (frcInterval && !frcFull && (uint32_t)(now - frcLast) < frcInterval)
+	{
+		return false;
+	}
+	frcLast = now;
 
-	//
-	byte pixelOffset = (y % 8);
+	const uint16_t stride = SSD1322_LCDWIDTH / 2;
+	uint8_t shift = frcBits - 4;
+	uint8_t mask = (1 << shift) - 1;
+	uint8_t row[SSD1322_LCDWIDTH / 2];
 
-	byte thing3 = (yy+h);
+	// a run of changed rows waiting to go out, and its column units
+	int16_t blockTop = -1;
+	uint8_t blockC0 = 0, blockC1 = 0;
 
-	//
-	for(byte hh=0;hh<h2;hh++)
+	for (int16_t y = 0; y <= SSD1322_LCDHEIGHT; y++)
 	{
-		//
-		byte hhh = (hh*8) + y;
-		byte hhhh = hhh + 8;
-
-		//
-		if(offsetY && (hhhh < yy || hhhh > SSD1322_LCDWIDTH || hhh > thing3))
-		continue;
+		int16_t b0 = -1, b1 = -1;
 
-		//
-		byte offsetMask = 0xFF;
-		if(offsetY)
+		if (y < SSD1322_LCDHEIGHT)
 		{
-			if(hhh < yy)
-			offsetMask = (0xFF<<(yy-hhh));
-			else if(hhhh > thing3)
-			offsetMask = (0xFF>>(hhhh-thing3));
-		}
-
-		unsigned int aa = ((hhh / 8) * SSD1322_LCDWIDTH);
+			const uint8_t *pImg = frcImage + y * SSD1322_LCDWIDTH;
+			const uint8_t *bayer = bayerGray[y & 3];
 
-		// If() outside of loop makes it faster (doesn't have to kee re-evaluating it)
-		// Downside is code duplication
-		if(!pixelOffset && hhh < SSD1322_LCDWIDTH)
-		{
-			//
-			for(byte ww=0;ww<w;ww++)
+			for (uint8_t i = 0; i < stride; i++)
 			{
-				// Workout X co-ordinate in frame buffer to place next 8 pixels
-				byte xx = ww + x;
-
-				// Stop if X co-ordinate is outside the frame
-				if(xx >= SSD1322_LCDWIDTH)
-				continue;
+				uint8_t v0 = pImg[2 * i];
+				uint8_t v1 = pImg[2 * i + 1];
+				uint8_t q0 = v0 >> shift;
+				uint8_t q1 = v1 >> shift;
+
+				// the phase in the cycle differs from pixel to pixel so a flat area does not flash as one
+				q0 += frcOrder[(frcPhase + bayer[(2 * i) & 3]) & mask] < (v0 & mask);
+				q1 += frcOrder[(frcPhase + bayer[(2 * i + 1) & 3]) & mask] < (v1 & mask);
+				if (q0 > 15) q0 = 15;
+				if (q1 > 15) q1 = 15;
+				row[i] = (q0 << 4) | q1;
+			}
 
-				// Read pixels
-				byte pixels = readPixels((bitmap + (hh*w)) + ww, invert) & offsetMask;
+			uint8_t *pBuf = &buffer[y * stride];
+			if (frcFull)
+			{
+				b0 = 0;
+				b1 = stride - 1;
+			}
+			else
+			{
+				for (uint8_t i = 0; i < stride; i++)
+				{
+					if (row[i] != pBuf[i])
+					{
+						if (b0 < 0)
+							b0 = i;
+						b1 = i;
+					}
+				}
+			}
+			if (b0 >= 0)
+			{
+				memcpy(pBuf, row, stride);
+			}
+		}
 
-				buffer[xx + aa] |= pixels;
+		if (b0 >= 0)
+		{
+			// 2 bytes per column unit
+			uint8_t c0 = b0 >> 1;
+			uint8_t c1 = b1 >> 1;
+			if (blockTop < 0)
+			{
+				blockTop = y;
+				blockC0 = c0;
+				blockC1 = c1;
+			}
+			else
+			{
+				blockC0 = min(blockC0, c0);
+				blockC1 = max(blockC1, c1);
 			}
+			continue;
 		}
-		else
+		if (blockTop < 0)
 		{
-			unsigned int aaa = ((hhhh / 8) * SSD1322_LCDWIDTH);
+			continue;
+		}
 
-			//
-			for(byte ww=0;ww<w;ww++)
-			{
-				// Workout X co-ordinate in frame buffer to place next 8 pixels
-				byte xx = ww + x;
+		// this row is the same, send the block above it
+		ssd1322_command(SSD1322_SETCOLUMNADDR);
+		ssd1322_data(MIN_SEG + blockC0);
+		ssd1322_data(MIN_SEG + blockC1);
 
-				// Stop if X co-ordinate is outside the frame
-				if(xx >= SSD1322_LCDWIDTH)
-				continue;
+		ssd1322_command(SSD1322_SETROWADDR);
+		ssd1322_data(blockTop);
+		ssd1322_data(y - 1);
 
-				// Read pixels
-				byte pixels = readPixels((bitmap + (hh*w)) + ww, invert) & offsetMask;
+		ssd1322_command(SSD1322_WRITERAM);
 
-				//
-				if(hhh < SSD1322_LCDHEIGHT)
-				{
-					buffer[xx + aa] |= pixels << pixelOffset;
-				}
-				//
-				if(hhhh < SSD1322_LCDHEIGHT)
-				{
-					buffer[xx + aaa] |= pixels >> (8 - pixelOffset);
-				}
-			}
+		uint16_t bytes = (blockC1 - blockC0 + 1) * 2;
+		for (int16_t r = blockTop; r < y; r++)
+		{
+			ssd1322_dataBytes(&buffer[r * stride + blockC0 * 2], bytes);
 		}
+		frcStat.rowsSent += y - blockTop;
+		frcStat.bytesSent += (uint32_t)bytes * (y - blockTop);
+		blockTop = -1;
+	}
+
+	frcFull = false;
+	frcPhase++;
+	frcStat.subFrames++;
+
+	// sub-frames per second, over whole seconds
+	frcWindowFrames++;
+	if ((uint32_t)(now - frcWindow) >= 1000000UL)
+	{
+		frcStat.rate = ((uint64_t)frcWindowFrames * 1000000UL) / (uint32_t)(now - frcWindow);
+		frcWindow = now;
+		frcWindowFrames = 0;
 	}
+	return true;
 }
+#endif
 
 /*
 //-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=
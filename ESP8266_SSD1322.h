@@ -51,6 +51,62 @@ All text above, and the splash screen must be included in any redistribution
 #define BLACK 0x00
 #define WHITE 0x0F
 #define INVERSE 2
+#define SSD1322_TRANSPARENT 0xFFFF	// as a background colour: leave the buffer alone
+
+// Raster ops, see setRasterOp()
+#define SSD1322_ROP_NORMAL 0	// colour decides: BLACK clears, WHITE/gray copies, INVERSE xors (1 bit mode)
+#define SSD1322_ROP_COPY 1	// dst = src
+#define SSD1322_ROP_SET 2	// dst = WHITE
+#define SSD1322_ROP_CLEAR 3	// dst = BLACK
+#define SSD1322_ROP_XOR 4	// dst ^= src, gray 15 inverts in 4 bit mode
+#define SSD1322_ROP_AND 5	// dst &= src
+#define SSD1322_ROP_OR 6	// dst |= src
+#define SSD1322_ROP_MAX 7	// dst = max(dst, src) per pixel (OR in 1 bit mode)
+#define SSD1322_ROP_MIN 8	// dst = min(dst, src) per pixel (AND in 1 bit mode)
+#define SSD1322_ROP_ADDS 9	// dst = min(dst + src, 15) per pixel (OR in 1 bit mode)
+
+// fillPolygon() fill rules
+#define SSD1322_FILL_EVENODD 0	// inside where an odd number of edges lie to the left
+#define SSD1322_FILL_NONZERO 1	// inside where the edges to the left do not cancel out
+
+// Edges fillPolygon() can hold (the edge table is static, 32 bytes per edge)
+#define SSD1322_POLY_MAX_EDGES 32
+
+// blit() flags
+#define SSD1322_BLIT_MASKED 0	// pixels that are not 0 take the colour, the rest stay
+#define SSD1322_BLIT_OPAQUE 1	// the bitmap's own pixels are written
+#define SSD1322_BLIT_RAM 2	// the bitmap is in RAM instead of PROGMEM
+#define SSD1322_BLIT_BILINEAR 4	// drawBitmapScaled(): blend neighbours instead of the nearest pixel
+
+// Bytes before the first row of an RLE bitmap, see drawRLEBitmap()
+#define SSD1322_RLE_HEADER 5
+
+// drawGray8() quantising
+#define SSD1322_DITHER_NONE 0	// nearest level
+#define SSD1322_DITHER_BAYER 1	// ordered, 4x4 Bayer matrix (8x8 in 1 bit mode)
+#define SSD1322_DITHER_FS 2	// Floyd-Steinberg error diffusion
+
+// SSD1322_Font glyph encodings
+#define SSD1322_FONT_BITMAP 0	// rows MSB left, each padded to whole bytes
+#define SSD1322_FONT_RLE 1	// runs of ink and background pixels, see extras/tools/ssd1322_font.cpp
+#define SSD1322_FONT_ALPHA 2	// 4 bit coverage, two pixels a byte, anti-aliased in 4 bit mode
+
+// Flag in a packed font's index record: the glyph has no ink and no data
+#define SSD1322_GLYPH_BLANK 0x01000000UL
+
+// Glyphs the glyph cache can hold at once, see setGlyphCache()
+#define SSD1322_GLYPH_CACHE_SLOTS 16
+
+// drawAlignedString() alignments
+#define SSD1322_ALIGN_LEFT 0	// the string starts at x
+#define SSD1322_ALIGN_CENTRE 1	// the string is centred on x
+#define SSD1322_ALIGN_RIGHT 2	// the string ends at x
+
+// Font sizes the font registry can hold, see registerFont()
+#define SSD1322_MAX_FONTS 16
+
+// Widest field drawInt(), drawFixed() and drawFloat() pad to, in characters
+#define SSD1322_NUMBER_WIDTH 23
 
 #define SSD1322_I2C_ADDRESS   0x3C	// 011110+SA0+RW - 0x3C or 0x3D
 // Address for 128x32 is 0x3C
@@ -125,6 +181,66 @@ All text above, and the splash screen must be included in any redistribution
 #define SSD1322_VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL 0x29
 #define SSD1322_VERTICAL_AND_LEFT_HORIZONTAL_SCROLL 0x2A
 
+typedef struct {
+  int16_t x;
+  int16_t y;
+} SSD1322_Point;
+
+typedef struct {
+  int16_t x;
+  int16_t y;
+  int16_t w;	// 0 for an empty rectangle
+  int16_t h;
+} SSD1322_Rect;
+
+// Code points first .. first + count - 1 of a font's sparse set, drawn with
+// glyphs glyph .. glyph + count - 1
+typedef struct {
+  uint16_t first;
+  uint16_t count;
+  uint16_t glyph;
+} SSD1322_CodeRange;
+
+// A proportional font for the size numbers of drawChar() and drawString():
+// characters first .. first + count - 1 are glyphs 0 .. count - 1, looked up
+// by subtraction; further code points come from ranges, sorted by first and
+// searched by halves.  Each glyph is width + gap pixels across.
+// The glyphs are either in widths and glyphs, or packed: one index record
+// per glyph, offset into data | width << 16, or SSD1322_GLYPH_BLANK for
+// a glyph without ink, so a glyph is found with one 32 bit read.  The tables
+// are PROGMEM; the descriptor itself stays in RAM.
+typedef struct {
+  uint8_t first;	// first character
+  uint8_t count;	// characters from first on
+  uint8_t height;	// rows of every glyph
+  int8_t gap;		// added to a glyph's width to give its advance
+  const uint8_t *widths;	// width of each glyph in pixels, NULL when packed
+  const uint8_t * const *glyphs;	// the glyph bitmaps, NULL when packed
+  uint8_t encoding;	// SSD1322_FONT_BITMAP, SSD1322_FONT_RLE or SSD1322_FONT_ALPHA
+  const uint32_t *index;	// packed: the index records, 4 byte aligned
+  const uint8_t *data;	// packed: all the glyphs, at most 64K
+  const SSD1322_CodeRange *ranges;	// code points past the first block, or NULL
+  uint16_t rangeCount;
+} SSD1322_Font;
+
+// How the glyph cache is doing, see setGlyphCache()
+typedef struct {
+  uint32_t hits;	// glyphs drawn from the cache
+  uint32_t misses;	// glyphs that were not in it
+  uint32_t evictions;	// glyphs dropped to make room
+  uint8_t hitRate;	// hits in percent of all lookups
+  uint8_t glyphs;	// glyphs held now
+  uint16_t bytes;	// cache memory in use
+} SSD1322_GlyphCacheStats;
+
+// What the FRC mode has done since beginFRC(), see frcUpdate()
+typedef struct {
+  uint32_t subFrames;	// sub-frames worked out
+  uint32_t rowsSent;	// panel rows sent, whole or in part
+  uint32_t bytesSent;	// pixel bytes sent
+  uint16_t rate;	// sub-frames per second over the last second
+} SSD1322_FrcStats;
+
 class ESP8266_SSD1322 : public Adafruit_GFX {
  public:
   ESP8266_SSD1322(int8_t SID, int8_t SCLK, int8_t DC, int8_t RST, int8_t CS);
@@ -139,6 +255,10 @@ class ESP8266_SSD1322 : public Adafruit_GFX {
   void clearDisplay(void);
   void invertDisplay(uint8_t i);
   void display();
+  void displayRect(const SSD1322_Rect &r);
+
+  void setRotation(uint8_t r);
+  void setFlushRotation(boolean enable);
 
   void startscrollright(uint8_t start, uint8_t stop);
   void startscrollleft(uint8_t start, uint8_t stop);
@@ -153,31 +273,112 @@ class ESP8266_SSD1322 : public Adafruit_GFX {
 
   void fill(uint8_t colour);
 
+  void setRasterOp(uint8_t op);
+  uint8_t getRasterOp(void);
+
+  void blit(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color, uint8_t flags = SSD1322_BLIT_MASKED);
+  void blitRect(int16_t x, int16_t y, const uint8_t *bitmap, uint16_t stride, int16_t sx, int16_t w, int16_t h,
+                uint16_t color, uint8_t flags = SSD1322_BLIT_MASKED);
   void fastDrawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h, uint8_t color);
+#ifdef SSD1322_256_64_4
+  void drawMonoBitmap4(int16_t x, int16_t y, const uint8_t *bits, int16_t w, int16_t h,
+                       uint16_t fg, uint16_t bg = SSD1322_TRANSPARENT, uint8_t flags = 0);
+  void drawBitmap4(int16_t x, int16_t y, const uint8_t *bitmap, int16_t w, int16_t h,
+                   uint16_t key = SSD1322_TRANSPARENT, const uint8_t *lut = NULL, uint8_t flags = 0);
+  static void makeGrayLut(uint8_t *lut, uint8_t scale, int8_t offset);
+
+  boolean beginFRC(const uint8_t *image, uint8_t bits = 8, uint16_t rate = 0);
+  void endFRC(void);
+  boolean frcUpdate(void);
+  SSD1322_FrcStats getFrcStats(void);
+#endif
   void ultraFastDrawBitmap(int16_t x, int16_t y, const uint8_t *bitmap, uint8_t w, uint8_t h, uint8_t color, bool invert);
+  boolean drawRLEBitmap(int16_t x, int16_t y, const uint8_t *rle, uint16_t color = WHITE, uint8_t flags = SSD1322_BLIT_OPAQUE);
+  boolean displayRLEBitmap(int16_t x, int16_t y, const uint8_t *rle, uint8_t flags = 0);
+  void drawBitmapScaled(int16_t x, int16_t y, const uint8_t *bitmap, int16_t sw, int16_t sh, uint8_t bpp,
+                        int16_t dw, int16_t dh, uint16_t color = WHITE, uint8_t flags = SSD1322_BLIT_OPAQUE);
+  void drawGray8(int16_t x, int16_t y, const uint8_t *pixels, int16_t w, int16_t h, uint8_t mode = SSD1322_DITHER_BAYER);
+
+  virtual void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  void drawPolyline(const SSD1322_Point *points, uint16_t n, uint16_t color);
+
+  uint16_t saveRect(const SSD1322_Rect &r, uint8_t *dst);
+  void restoreRect(const SSD1322_Rect &r, const uint8_t *src);
+  static uint16_t saveSize(int16_t w, int16_t h);
 
   virtual void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
   virtual void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
+  virtual void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void drawCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillCircle(int16_t x0, int16_t y0, int16_t r, uint16_t color);
+  void fillRoundRect(int16_t x, int16_t y, int16_t w, int16_t h, int16_t r, uint16_t color);
+  void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t color);
+  boolean fillPolygon(const SSD1322_Point *points, uint16_t n, uint16_t color, uint8_t rule = SSD1322_FILL_EVENODD);
+
+  static boolean registerFont(uint8_t size, const SSD1322_Font *font);
+  static const SSD1322_Font *getFont(uint8_t size);
+
+  static void setGlyphCache(uint8_t *mem, uint16_t size);
+  static void flushGlyphCache(void);
+  static SSD1322_GlyphCacheStats getGlyphCacheStats(void);
+
+  uint8_t getTextSize(void);
+  uint16_t getTextColor(void);
+  uint16_t getTextBgColor(void);
 
   int drawUnicode(unsigned int uniCode, int x, int y, int size);
   int drawNumber(long long_num,int poX, int poY, int size);
+  int drawInt(long value, int x, int y, int size, uint8_t width = 0, char pad = ' ');
+  int drawFixed(long value, uint8_t decimals, int x, int y, int size, uint8_t width = 0, char pad = ' ');
   int drawChar(char c, int x, int y, int size);
-  int drawString(char *string, int poX, int poY, int size);
-  int drawCentreString(char *string, int dX, int poY, int size);
-  int drawRightString(char *string, int dX, int poY, int size);
-  int drawFloat(float floatNumber,int decimal,int poX, int poY, int size);
+  int drawString(const char *string, int poX, int poY, int size);
+  int drawCentreString(const char *string, int dX, int poY, int size);
+  int drawRightString(const char *string, int dX, int poY, int size);
+  int measureString(const char *string, int size);
+  SSD1322_Rect drawAlignedString(const char *string, int x, int y, int size, uint8_t align = SSD1322_ALIGN_LEFT);
+  int drawFloat(float floatNumber,int decimal,int poX, int poY, int size, uint8_t width = 0, char pad = ' ');
+
+  static char *formatFixed(char *buf, long value, uint8_t decimals, uint8_t width = 0, char pad = ' ');
+  static char *formatFloat(char *buf, float value, int decimals, uint8_t width = 0, char pad = ' ');
+  static uint16_t decodeUtf8(const char *&string);
 
  private:
   int8_t _i2caddr, sid, sclk, dc, rst, cs;
   void fastSPIwrite(uint8_t c);
   void fastSPIwriteBytes(uint8_t * data, uint32_t const size);
 
+  uint8_t rasterOp;
+  boolean flushRotation, remapFlipped;
+  void updateGeometry(void);
+  void setRemap(boolean flip);
+  inline void toBuffer(int16_t &x, int16_t &y);
+  boolean bufferRect(const SSD1322_Rect &r, int16_t &x0, int16_t &y0, int16_t &x1, int16_t &y1);
+  void displayTransposed(void);
+
+  void resolveRop(uint16_t color, uint8_t &op, uint8_t &src);
+  SSD1322_Rect alignString(const char *string, int x, int y, int size, uint8_t align, int &len);
+  void pixelLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint16_t color, uint8_t skip);
+  void drawRunGlyph(uint32_t glyph, int x, int y, uint8_t width, uint8_t height, int8_t gap, boolean opaque);
+  void drawAlphaGlyph(uint32_t glyph, int x, int y, uint8_t width, uint8_t height, int8_t gap, boolean opaque);
+
+#ifdef SSD1322_256_64_4
+  const uint8_t *frcImage;
+  uint8_t frcBits, frcPhase;
+  boolean frcFull;
+  uint32_t frcInterval, frcLast, frcWindow;
+  uint16_t frcWindowFrames;
+  SSD1322_FrcStats frcStat;
+#endif
+
   boolean hwSPI;
   PortReg *mosiport, *clkport, *csport, *dcport;
   PortMask mosipinmask, clkpinmask, cspinmask, dcpinmask;
 
-  inline void drawFastVLineInternal(int16_t x, int16_t y, int16_t h, uint16_t color) __attribute__((always_inline));
-  inline void drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint16_t color) __attribute__((always_inline));
+  void hspan(int16_t x, int16_t y, int16_t w, uint8_t op, uint8_t src);
+  void vspan(int16_t x, int16_t y, int16_t h, uint8_t op, uint8_t src);
+  void rowSpan(int16_t x0, int16_t x1, int16_t y, uint8_t op, uint8_t src);
+  inline void drawFastVLineInternal(int16_t x, int16_t y, int16_t h, uint8_t op, uint8_t src) __attribute__((always_inline));
+  inline void drawFastHLineInternal(int16_t x, int16_t y, int16_t w, uint8_t op, uint8_t src) __attribute__((always_inline));
 
 };
 
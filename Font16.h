@@ -2,6 +2,7 @@
 #define chr_hgt_f16 16
 #define data_size_f16 8
 #define firstchr_f16 32
+#define enc_f16 0		// glyph encoding, SSD1322_FONT_BITMAP
 
 extern const unsigned char widtbl_f16[96];
 //extern const unsigned char* const PROGMEM chrtbl_f16[96];       // character pointer table
@@ -1,4 +1,4 @@
-// Font size 4
+// Font size 4, run length encoded by ssd1322_font
 
 #include "Font32.h"
 
@@ -11,1026 +11,449 @@
  #define PROGMEM
 #endif
 
-
-PROGMEM const unsigned char widtbl_f32[96] =         // character width table
-{
-        8, 11, 11, 22, 17, 24, 20, 9,       // char 32 - 39
-        11, 11, 15, 13, 10, 11, 10, 11,     // char 40 - 47
-        17, 17, 17, 17, 17, 17, 17, 17,     // char 48 - 55
-        17, 17, 10, 10, 17, 12, 17, 16,     // char 56 - 63
-        28, 19, 20, 21, 21, 19, 18, 22,     // char 64 - 71
-        21, 9, 16, 20, 16, 24, 21, 22,      // char 72 - 79
-        19, 22, 20, 19, 17, 21, 18, 26,     // char 80 - 87
-        18, 19, 19, 12, 16, 12, 15, 16,     // char 88 - 95
-        9, 17, 18, 16, 18, 17, 11, 18,      // char 96 - 103
-        18, 9, 9, 15, 9, 25, 18, 18,        // char 104 - 111
-        18, 18, 11, 15, 10, 17, 15, 21,     // char 112 - 119
-        16, 16, 15, 16, 16, 16, 18, 4       // char 120 - 127
+PROGMEM const uint32_t idxtbl_f32[96] =         // offset | width << 16, or SSD1322_GLYPH_BLANK
+{
+  0x01080000, 0x000B0000, 0x000B0021, 0x0016003F, 0x00110081, 0x001800AE, 0x0014010C, 0x00090152,
+  0x000B0160, 0x000B0191, 0x000F01C2, 0x000D01E2, 0x000A01F4, 0x000B0204, 0x000A020A, 0x000B0212,
+  0x0011023B, 0x00110278, 0x0011029B, 0x001102C6, 0x001102F7, 0x00110328, 0x00110357, 0x00110390,
+  0x001103B4, 0x001103ED, 0x000A0426, 0x000A0433, 0x00110448, 0x000C045D, 0x00110467, 0x0010047B,
+  0x001C04A4, 0x0013051B, 0x0014055B, 0x00150599, 0x001505D1, 0x00130613, 0x00120639, 0x0016065F,
+  0x0015069F, 0x000906E5, 0x0010070A, 0x00140737, 0x0010077F, 0x001807A4, 0x00150820, 0x0016087E,
+  0x001308C0, 0x001608F2, 0x0014093C, 0x0013097E, 0x001109B4, 0x001509D9, 0x00120A1F, 0x001A0A63,
+  0x00120AE3, 0x00130B27, 0x00130B5D, 0x000C0B83, 0x00100BB2, 0x000C0BE5, 0x000F0C14, 0x00100C29,
+  0x00090C2E, 0x00110C3C, 0x00120C67, 0x00100CA7, 0x00120CCC, 0x00110D0C, 0x000B0D31, 0x00120D56,
+  0x00120D9D, 0x00090DDD, 0x00090DFE, 0x000F0E2B, 0x000906E5, 0x00190E64, 0x00120EB5, 0x00120EEB,
+  0x00120F19, 0x00120F58, 0x000B0F97, 0x000F0FB4, 0x000A0FD7, 0x00110FFA, 0x000F102F, 0x0015105E,
+  0x001010B8, 0x001010E7, 0x000F1126, 0x00101141, 0x00101174, 0x001011A7, 0x001211DA, 0x01040000
 };
 
-// Row format, MSB left
-
-PROGMEM const unsigned char chr_f32_20[] =         // 1 byte per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00,    // row 1 - 11
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 12 - 22
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00           // row 23 - 32
-};
-PROGMEM const unsigned char chr_f32_21[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 7 - 12
-        0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 13 - 18
-        0x18, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 19 - 24
-        0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_22[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00, 0x24, 0x00,    // row 7 - 12
-        0x24, 0x00, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_23[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x66, 0x00, 0x00, 0x44, 0x00, 0x00, 0x44, 0x00, 0x00, 0xCC, 0x00,    // row 9 - 12
-        0x00, 0x88, 0x00, 0x00, 0x88, 0x00, 0x1F, 0xFF, 0x80, 0x01, 0x10, 0x00,    // row 13 - 16
-        0x01, 0x10, 0x00, 0x01, 0x10, 0x00, 0x3F, 0xFF, 0x00, 0x02, 0x20, 0x00,    // row 17 - 20
-        0x02, 0x20, 0x00, 0x06, 0x60, 0x00, 0x04, 0x40, 0x00, 0x04, 0x40, 0x00,    // row 21 - 24
-        0x0C, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_24[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x38, 0x70, 0x00, 0x60, 0x18, 0x00,    // row 9 - 12
-        0x60, 0x18, 0x00, 0x60, 0x00, 0x00, 0x70, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 13 - 16
-        0x7F, 0x80, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00,    // row 17 - 20
-        0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0x88, 0x00, 0x7F, 0xF8, 0x00,    // row 21 - 24
-        0x60, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_25[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x0E, 0x01, 0x80, 0x3F, 0x81, 0x00, 0x31, 0x83, 0x00, 0x60, 0xC6, 0x00,    // row 9 - 12
-        0x60, 0xC4, 0x00, 0x60, 0xCC, 0x00, 0x31, 0x88, 0x00, 0x3F, 0x90, 0x00,    // row 13 - 16
-        0x0E, 0x31, 0xC0, 0x00, 0x27, 0xF0, 0x00, 0x46, 0x30, 0x00, 0xCC, 0x18,    // row 17 - 20
-        0x00, 0x8C, 0x18, 0x01, 0x8C, 0x18, 0x03, 0x06, 0x30, 0x02, 0x07, 0xF0,    // row 21 - 24
-        0x06, 0x01, 0xC0, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_26[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x07, 0xC0, 0x00,    // row 5 - 8
-        0x0F, 0xE0, 0x00, 0x1C, 0x70, 0x00, 0x18, 0x30, 0x00, 0x18, 0x30, 0x00,    // row 9 - 12
-        0x18, 0x70, 0x00, 0x0C, 0xE0, 0x00, 0x07, 0xC0, 0x00, 0x0F, 0x00, 0x00,    // row 13 - 16
-        0x1F, 0x86, 0x00, 0x39, 0xC6, 0x00, 0x70, 0xE6, 0x00, 0x60, 0x7C, 0x00,    // row 17 - 20
-        0x60, 0x3C, 0x00, 0x60, 0x18, 0x00, 0x70, 0x7E, 0x00, 0x3F, 0xE7, 0x00,    // row 21 - 24
-        0x1F, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_27[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x70, 0x00, 0x70, 0x00, 0x70, 0x00, 0x10, 0x00, 0x30, 0x00,    // row 7 - 12
-        0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_28[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x03, 0x00, 0x02, 0x00, 0x06, 0x00, 0x04, 0x00, 0x0C, 0x00,    // row 7 - 12
-        0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 13 - 18
-        0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 19 - 24
-        0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x06, 0x00, 0x02, 0x00,    // row 25 - 30
-        0x03, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_29[] =         // 2 bytes per row
-{
-        0x00, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x60, 0x00, 0x20, 0x00, 0x30, 0x00,    // row 7 - 12
-        0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 13 - 18
-        0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 19 - 24
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x20, 0x00, 0x60, 0x00, 0x40, 0x00,    // row 25 - 30
-        0xC0, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_2A[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x26, 0x40, 0x7F, 0xE0,    // row 7 - 12
-        0x1F, 0x80, 0x0F, 0x00, 0x19, 0x80, 0x39, 0xC0, 0x10, 0x80, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_2B[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x7F, 0x80,    // row 13 - 18
-        0x7F, 0x80, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_2C[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00,    // row 19 - 24
-        0x38, 0x00, 0x08, 0x00, 0x18, 0x00, 0x10, 0x00, 0x30, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_2D[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,    // row 13 - 18
-        0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_2E[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00,    // row 19 - 24
-        0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_2F[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x02, 0x00, 0x06, 0x00, 0x06, 0x00,    // row 7 - 12
-        0x04, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x08, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 13 - 18
-        0x10, 0x00, 0x30, 0x00, 0x30, 0x00, 0x20, 0x00, 0x60, 0x00, 0x60, 0x00,    // row 19 - 24
-        0x40, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_30[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x07, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x3C, 0xF0, 0x00, 0x30, 0x30, 0x00,    // row 9 - 12
-        0x70, 0x38, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00,    // row 13 - 16
-        0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00,    // row 17 - 20
-        0x70, 0x38, 0x00, 0x30, 0x30, 0x00, 0x3C, 0xF0, 0x00, 0x1F, 0xE0, 0x00,    // row 21 - 24
-        0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_31[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x03, 0x80, 0x00, 0x1F, 0x80, 0x00,    // row 9 - 12
-        0x1F, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,    // row 13 - 16
-        0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,    // row 17 - 20
-        0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,    // row 21 - 24
-        0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_32[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x0F, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x38, 0x70, 0x00, 0x70, 0x18, 0x00,    // row 9 - 12
-        0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x38, 0x00,    // row 13 - 16
-        0x00, 0xF0, 0x00, 0x03, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00,    // row 17 - 20
-        0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x7F, 0xF8, 0x00,    // row 21 - 24
-        0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_33[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x0F, 0xC0, 0x00, 0x1F, 0xE0, 0x00, 0x38, 0x70, 0x00, 0x30, 0x30, 0x00,    // row 9 - 12
-        0x70, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00, 0x03, 0xE0, 0x00,    // row 13 - 16
-        0x03, 0xF0, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x00, 0x60, 0x18, 0x00,    // row 17 - 20
-        0x60, 0x18, 0x00, 0x70, 0x38, 0x00, 0x38, 0x70, 0x00, 0x3F, 0xF0, 0x00,    // row 21 - 24
-        0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_34[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xE0, 0x00, 0x01, 0xE0, 0x00,    // row 9 - 12
-        0x03, 0x60, 0x00, 0x06, 0x60, 0x00, 0x0C, 0x60, 0x00, 0x0C, 0x60, 0x00,    // row 13 - 16
-        0x18, 0x60, 0x00, 0x30, 0x60, 0x00, 0x60, 0x60, 0x00, 0x7F, 0xF8, 0x00,    // row 17 - 20
-        0x7F, 0xF8, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00,    // row 21 - 24
-        0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_35[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x3F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 9 - 12
-        0x30, 0x00, 0x00, 0x37, 0xC0, 0x00, 0x3F, 0xF0, 0x00, 0x78, 0x70, 0x00,    // row 13 - 16
-        0x60, 0x38, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,    // row 17 - 20
-        0x60, 0x18, 0x00, 0x70, 0x38, 0x00, 0x38, 0x70, 0x00, 0x3F, 0xF0, 0x00,    // row 21 - 24
-        0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_36[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x07, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x38, 0x30, 0x00, 0x30, 0x18, 0x00,    // row 9 - 12
-        0x30, 0x18, 0x00, 0x60, 0x00, 0x00, 0x67, 0xC0, 0x00, 0x7F, 0xF0, 0x00,    // row 13 - 16
-        0x78, 0x70, 0x00, 0x70, 0x38, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00,    // row 17 - 20
-        0x60, 0x18, 0x00, 0x30, 0x38, 0x00, 0x38, 0x70, 0x00, 0x1F, 0xF0, 0x00,    // row 21 - 24
-        0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_37[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x7F, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x00, 0x30, 0x00, 0x00, 0x70, 0x00,    // row 9 - 12
-        0x00, 0xE0, 0x00, 0x00, 0xC0, 0x00, 0x01, 0xC0, 0x00, 0x01, 0x80, 0x00,    // row 13 - 16
-        0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x06, 0x00, 0x00,    // row 17 - 20
-        0x06, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x0C, 0x00, 0x00,    // row 21 - 24
-        0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_38[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x07, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x18, 0x60, 0x00, 0x30, 0x30, 0x00,    // row 9 - 12
-        0x30, 0x30, 0x00, 0x30, 0x30, 0x00, 0x18, 0x60, 0x00, 0x0F, 0xC0, 0x00,    // row 13 - 16
-        0x1F, 0xE0, 0x00, 0x38, 0x70, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00,    // row 17 - 20
-        0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x38, 0x70, 0x00, 0x3F, 0xF0, 0x00,    // row 21 - 24
-        0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_39[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x38, 0x70, 0x00, 0x70, 0x30, 0x00,    // row 9 - 12
-        0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x70, 0x38, 0x00,    // row 13 - 16
-        0x38, 0x78, 0x00, 0x3F, 0xF8, 0x00, 0x0F, 0x98, 0x00, 0x00, 0x18, 0x00,    // row 17 - 20
-        0x60, 0x30, 0x00, 0x60, 0x30, 0x00, 0x30, 0x70, 0x00, 0x3F, 0xE0, 0x00,    // row 21 - 24
-        0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_3A[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00,    // row 19 - 24
-        0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_3B[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x00,    // row 19 - 24
-        0x38, 0x00, 0x08, 0x00, 0x18, 0x00, 0x10, 0x00, 0x30, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_3C[] =        // 3 bytes per row
-{
-           // row 1 - 3
-           // row 4 - 6  I                 I
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 9
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 10 - 12
-        0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0xE0, 0x00,    // row 13 - 15
-        0x07, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x60, 0x00, 0x00,    // row 16 - 18
-        0x1C, 0x00, 0x00, 0x03, 0x80, 0x00, 0x00, 0xE0, 0x00,    // row 19 - 21
-        0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 22 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 27
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 28 - 30
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00                             // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_3D[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x7F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_3E[] =        // 4 bytes per row
-{
-           // row 1 - 3
-           // row 4 - 6        I                       I
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 9
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 10 - 12
-        0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x1C, 0x00, 0x00,    // row 13 - 15
-        0x07, 0x80, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x18, 0x00,    // row 16 - 18
-        0x00, 0xE0, 0x00, 0x07, 0x80, 0x00, 0x1C, 0x00, 0x00,    // row 19 - 21
-        0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 22 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 27
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 28 - 30
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00                             // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_3F[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x0F, 0xC0, 0x3F, 0xE0, 0x38, 0x70, 0x70, 0x30, 0x60, 0x30,    // row 7 - 12
-        0x60, 0x30, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x03, 0x00,    // row 13 - 18
-        0x07, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00,    // row 19 - 24
-        0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_40[] =        // 4 bytes per row
-{
-           // row 1 - 3
-           // row 4 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x01, 0xC0, 0x70, 0x00,    // row 7 - 9
-        0x07, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x06, 0x00,    // row 10 - 12
-        0x10, 0x1E, 0x43, 0x00, 0x30, 0x63, 0xC3, 0x00, 0x30, 0xC1, 0x83, 0x00,    // row 13 - 15
-        0x60, 0xC1, 0x83, 0x00, 0x61, 0x81, 0x83, 0x00, 0x61, 0x81, 0x83, 0x00,    // row 16 - 18
-        0x61, 0x83, 0x06, 0x00, 0x61, 0x83, 0x06, 0x00, 0x61, 0x83, 0x0C, 0x00,    // row 19 - 21
-        0x30, 0xC7, 0x18, 0x00, 0x30, 0x79, 0xF0, 0x00, 0x18, 0x00, 0x00, 0x00,    // row 22 - 24
-        0x0C, 0x00, 0x00, 0x00, 0x06, 0x00, 0x18, 0x00, 0x03, 0x81, 0xE0, 0x00,    // row 25 - 27
-        0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 28 - 30
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                             // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_41[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x03, 0xC0, 0x00,    // row 5 - 8
-        0x03, 0xC0, 0x00, 0x03, 0xC0, 0x00, 0x06, 0x60, 0x00, 0x06, 0x60, 0x00,    // row 9 - 12
-        0x06, 0x60, 0x00, 0x0C, 0x30, 0x00, 0x0C, 0x30, 0x00, 0x0C, 0x30, 0x00,    // row 13 - 16
-        0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x1F, 0xF8, 0x00, 0x3F, 0xFC, 0x00,    // row 17 - 20
-        0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,    // row 21 - 24
-        0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_42[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,    // row 5 - 8
-        0x3F, 0xFE, 0x00, 0x30, 0x0E, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00,    // row 9 - 12
-        0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x0E, 0x00, 0x3F, 0xF8, 0x00,    // row 13 - 16
-        0x3F, 0xFE, 0x00, 0x30, 0x0E, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,    // row 17 - 20
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x0E, 0x00, 0x3F, 0xFE, 0x00,    // row 21 - 24
-        0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_43[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,    // row 5 - 8
-        0x0F, 0xFE, 0x00, 0x1E, 0x0F, 0x00, 0x38, 0x03, 0x00, 0x30, 0x01, 0x80,    // row 9 - 12
-        0x70, 0x01, 0x80, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00,    // row 13 - 16
-        0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x01, 0x80, 0x70, 0x01, 0x80,    // row 17 - 20
-        0x30, 0x03, 0x80, 0x38, 0x03, 0x00, 0x1E, 0x0F, 0x00, 0x0F, 0xFE, 0x00,    // row 21 - 24
-        0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_44[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x3F, 0xF0, 0x00,    // row 5 - 8
-        0x3F, 0xFC, 0x00, 0x30, 0x1E, 0x00, 0x30, 0x07, 0x00, 0x30, 0x03, 0x00,    // row 9 - 12
-        0x30, 0x03, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80,    // row 13 - 16
-        0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x01, 0x80, 0x30, 0x03, 0x80,    // row 17 - 20
-        0x30, 0x03, 0x00, 0x30, 0x07, 0x00, 0x30, 0x1E, 0x00, 0x3F, 0xFC, 0x00,    // row 21 - 24
-        0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_45[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,    // row 5 - 8
-        0x3F, 0xFE, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 9 - 12
-        0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0xFC, 0x00,    // row 13 - 16
-        0x3F, 0xFC, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 17 - 20
-        0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0xFE, 0x00,    // row 21 - 24
-        0x3F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_46[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,    // row 5 - 8
-        0x3F, 0xFC, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 9 - 12
-        0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x3F, 0xF8, 0x00,    // row 13 - 16
-        0x3F, 0xF8, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 17 - 20
-        0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 21 - 24
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_47[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,    // row 5 - 8
-        0x0F, 0xFE, 0x00, 0x1C, 0x0F, 0x00, 0x38, 0x03, 0x00, 0x30, 0x03, 0x80,    // row 9 - 12
-        0x70, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x00, 0x00, 0x60, 0x7F, 0x80,    // row 13 - 16
-        0x60, 0x7F, 0x80, 0x60, 0x01, 0x80, 0x60, 0x01, 0x80, 0x70, 0x01, 0x80,    // row 17 - 20
-        0x30, 0x03, 0x80, 0x38, 0x07, 0x80, 0x1E, 0x0F, 0x80, 0x0F, 0xFD, 0x80,    // row 21 - 24
-        0x03, 0xF0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_48[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x30, 0x03, 0x00,    // row 5 - 8
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,    // row 9 - 12
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x3F, 0xFF, 0x00, 0x3F, 0xFF, 0x00,    // row 13 - 16
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,    // row 17 - 20
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,    // row 21 - 24
-        0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_49[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 7 - 12
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 13 - 18
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 19 - 24
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_4A[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60,    // row 7 - 12
-        0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60,    // row 13 - 18
-        0x00, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xE0, 0xE0, 0x7F, 0xC0,    // row 19 - 24
-        0x3F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_4B[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x30, 0x07, 0x00,    // row 5 - 8
-        0x30, 0x0E, 0x00, 0x30, 0x1C, 0x00, 0x30, 0x38, 0x00, 0x30, 0x70, 0x00,    // row 9 - 12
-        0x30, 0xE0, 0x00, 0x31, 0xC0, 0x00, 0x33, 0x80, 0x00, 0x37, 0x80, 0x00,    // row 13 - 16
-        0x3F, 0xC0, 0x00, 0x3C, 0xE0, 0x00, 0x38, 0x70, 0x00, 0x30, 0x30, 0x00,    // row 17 - 20
-        0x30, 0x38, 0x00, 0x30, 0x1C, 0x00, 0x30, 0x0E, 0x00, 0x30, 0x07, 0x00,    // row 21 - 24
-        0x30, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_4C[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 7 - 12
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 13 - 18
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3F, 0xF8,    // row 19 - 24
-        0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_4D[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x38, 0x00, 0xE0,    // row 5 - 8
-        0x3C, 0x01, 0xE0, 0x3C, 0x01, 0xE0, 0x3C, 0x01, 0xE0, 0x36, 0x03, 0x60,    // row 9 - 12
-        0x36, 0x03, 0x60, 0x36, 0x03, 0x60, 0x33, 0x06, 0x60, 0x33, 0x06, 0x60,    // row 13 - 16
-        0x33, 0x06, 0x60, 0x31, 0x8C, 0x60, 0x31, 0x8C, 0x60, 0x31, 0x8C, 0x60,    // row 17 - 20
-        0x30, 0xD8, 0x60, 0x30, 0xD8, 0x60, 0x30, 0xF8, 0x60, 0x30, 0x70, 0x60,    // row 21 - 24
-        0x30, 0x70, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_4E[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x38, 0x03, 0x00,    // row 5 - 8
-        0x38, 0x03, 0x00, 0x3C, 0x03, 0x00, 0x3E, 0x03, 0x00, 0x36, 0x03, 0x00,    // row 9 - 12
-        0x37, 0x03, 0x00, 0x33, 0x83, 0x00, 0x31, 0x83, 0x00, 0x31, 0xC3, 0x00,    // row 13 - 16
-        0x30, 0xE3, 0x00, 0x30, 0x63, 0x00, 0x30, 0x73, 0x00, 0x30, 0x3B, 0x00,    // row 17 - 20
-        0x30, 0x1B, 0x00, 0x30, 0x1F, 0x00, 0x30, 0x0F, 0x00, 0x30, 0x07, 0x00,    // row 21 - 24
-        0x30, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_4F[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,    // row 5 - 8
-        0x0F, 0xFE, 0x00, 0x1E, 0x0F, 0x00, 0x38, 0x03, 0x80, 0x30, 0x01, 0x80,    // row 9 - 12
-        0x70, 0x01, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0,    // row 13 - 16
-        0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x70, 0x01, 0xC0,    // row 17 - 20
-        0x30, 0x01, 0x80, 0x38, 0x03, 0x80, 0x1E, 0x0F, 0x00, 0x0F, 0xFE, 0x00,    // row 21 - 24
-        0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_50[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x3F, 0xF8, 0x00,    // row 5 - 8
-        0x3F, 0xFC, 0x00, 0x30, 0x0E, 0x00, 0x30, 0x06, 0x00, 0x30, 0x06, 0x00,    // row 9 - 12
-        0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x30, 0x0E, 0x00, 0x3F, 0xFC, 0x00,    // row 13 - 16
-        0x3F, 0xF8, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 17 - 20
-        0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 21 - 24
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_51[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x03, 0xF8, 0x00,    // row 5 - 8
-        0x0F, 0xFE, 0x00, 0x1E, 0x0F, 0x00, 0x38, 0x03, 0x80, 0x30, 0x01, 0x80,    // row 9 - 12
-        0x70, 0x01, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0,    // row 13 - 16
-        0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x60, 0x00, 0xC0, 0x70, 0x11, 0xC0,    // row 17 - 20
-        0x30, 0x39, 0x80, 0x38, 0x1F, 0x80, 0x1E, 0x0F, 0x00, 0x0F, 0xFF, 0x80,    // row 21 - 24
-        0x03, 0xF9, 0xC0, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_52[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x3F, 0xFC, 0x00,    // row 5 - 8
-        0x3F, 0xFE, 0x00, 0x30, 0x07, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,    // row 9 - 12
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x06, 0x00, 0x3F, 0xFE, 0x00,    // row 13 - 16
-        0x3F, 0xFC, 0x00, 0x30, 0x0E, 0x00, 0x30, 0x06, 0x00, 0x30, 0x07, 0x00,    // row 17 - 20
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,    // row 21 - 24
-        0x30, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_53[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x07, 0xE0, 0x00,    // row 5 - 8
-        0x1F, 0xF8, 0x00, 0x38, 0x1C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00,    // row 9 - 12
-        0x30, 0x0E, 0x00, 0x38, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x0F, 0xE0, 0x00,    // row 13 - 16
-        0x01, 0xF8, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x0E, 0x00, 0x70, 0x06, 0x00,    // row 17 - 20
-        0x30, 0x06, 0x00, 0x30, 0x06, 0x00, 0x3C, 0x0E, 0x00, 0x1F, 0xFC, 0x00,    // row 21 - 24
-        0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_54[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00,    // row 5 - 8
-        0xFF, 0xFC, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,    // row 9 - 12
-        0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,    // row 13 - 16
-        0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,    // row 17 - 20
-        0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00, 0x03, 0x00, 0x00,    // row 21 - 24
-        0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_55[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x30, 0x03, 0x00,    // row 5 - 8
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,    // row 9 - 12
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,    // row 13 - 16
-        0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x03, 0x00,    // row 17 - 20
-        0x30, 0x03, 0x00, 0x38, 0x07, 0x00, 0x1C, 0x0E, 0x00, 0x0F, 0xFC, 0x00,    // row 21 - 24
-        0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_56[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00,    // row 5 - 8
-        0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x30, 0x18, 0x00,    // row 9 - 12
-        0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x18, 0x30, 0x00, 0x18, 0x30, 0x00,    // row 13 - 16
-        0x18, 0x30, 0x00, 0x0C, 0x60, 0x00, 0x0C, 0x60, 0x00, 0x0C, 0x60, 0x00,    // row 17 - 20
-        0x06, 0xC0, 0x00, 0x06, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0x80, 0x00,    // row 21 - 24
-        0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_57[] =        // 4 bytes per row
-{
-           // row 1 - 3
-           // row 4 - 6
-        0x00, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x0E, 0x00, 0x60, 0x38, 0x0C, 0x00,    // row 7 - 9
-        0x60, 0x38, 0x0C, 0x00, 0x70, 0x6C, 0x1C, 0x00, 0x30, 0x6C, 0x18, 0x00,    // row 10 - 12
-        0x30, 0x6C, 0x18, 0x00, 0x30, 0x6C, 0x18, 0x00, 0x38, 0xC6, 0x38, 0x00,    // row 13 - 15
-        0x18, 0xC6, 0x30, 0x00, 0x18, 0xC6, 0x30, 0x00, 0x18, 0xC6, 0x30, 0x00,    // row 16 - 18
-        0x1D, 0x83, 0x70, 0x00, 0x0D, 0x83, 0x60, 0x00, 0x0D, 0x83, 0x60, 0x00,    // row 19 - 21
-        0x0D, 0x83, 0x60, 0x00, 0x0F, 0x01, 0xE0, 0x00, 0x07, 0x01, 0xC0, 0x00,    // row 22 - 24
-        0x07, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 27
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 28 - 30
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                             // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_58[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x60, 0x0C, 0x00,    // row 5 - 8
-        0x70, 0x1C, 0x00, 0x30, 0x18, 0x00, 0x18, 0x30, 0x00, 0x1C, 0x70, 0x00,    // row 9 - 12
-        0x0C, 0x60, 0x00, 0x06, 0xC0, 0x00, 0x07, 0xC0, 0x00, 0x03, 0x80, 0x00,    // row 13 - 16
-        0x03, 0x80, 0x00, 0x06, 0xC0, 0x00, 0x0E, 0xE0, 0x00, 0x0C, 0x60, 0x00,    // row 17 - 20
-        0x18, 0x30, 0x00, 0x38, 0x38, 0x00, 0x30, 0x18, 0x00, 0x70, 0x1C, 0x00,    // row 21 - 24
-        0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_59[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0xE0, 0x07, 0x00,    // row 5 - 8
-        0x70, 0x0E, 0x00, 0x30, 0x0C, 0x00, 0x38, 0x1C, 0x00, 0x18, 0x18, 0x00,    // row 9 - 12
-        0x0C, 0x30, 0x00, 0x0E, 0x70, 0x00, 0x06, 0x60, 0x00, 0x03, 0xC0, 0x00,    // row 13 - 16
-        0x03, 0xC0, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,    // row 17 - 20
-        0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00, 0x01, 0x80, 0x00,    // row 21 - 24
-        0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_5A[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x3F, 0xFE, 0x00,    // row 5 - 8
-        0x3F, 0xFE, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00,    // row 9 - 12
-        0x00, 0x30, 0x00, 0x00, 0x60, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00,    // row 13 - 16
-        0x03, 0x80, 0x00, 0x03, 0x00, 0x00, 0x06, 0x00, 0x00, 0x0E, 0x00, 0x00,    // row 17 - 20
-        0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0x7F, 0xFE, 0x00,    // row 21 - 24
-        0x7F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_5B[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 7 - 12
-        0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 13 - 18
-        0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00,    // row 19 - 24
-        0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x18, 0x00, 0x1F, 0x00, 0x1F, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_5C[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x20, 0x00, 0x20, 0x00, 0x30, 0x00, 0x10, 0x00, 0x10, 0x00, 0x18, 0x00,    // row 7 - 12
-        0x08, 0x00, 0x08, 0x00, 0x0C, 0x00, 0x04, 0x00, 0x04, 0x00, 0x06, 0x00,    // row 13 - 18
-        0x02, 0x00, 0x02, 0x00, 0x03, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x80,    // row 19 - 24
-        0x00, 0x80, 0x00, 0x80, 0x00, 0xC0, 0x00, 0x40, 0x00, 0x40, 0x00, 0x60,    // row 25 - 30
-        0x00, 0x20, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_5D[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x7C, 0x00, 0x7C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,    // row 7 - 12
-        0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,    // row 13 - 18
-        0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00,    // row 19 - 24
-        0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x0C, 0x00, 0x7C, 0x00, 0x7C, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_5E[] =        // 2 bytes per row
-{
-           // row 1 - 3
-           // row 4 - 6        I                       I
-        0x00, 0x00, 0x07, 0x00, 0x0D, 0x80,    // row 7 - 9
-        0x18, 0xC0, 0x30, 0x60, 0x60, 0x30,    // row 10 - 12
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 15
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 16 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 21
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 22 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 27
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 28 - 30
-        0x00, 0x00, 0x00, 0x00                             // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_5F[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_60[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x30, 0x00, 0x60, 0x00, 0x40, 0x00, 0x70, 0x00, 0x70, 0x00,    // row 7 - 12
-        0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_61[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 9 - 12
-        0x0F, 0xC0, 0x00, 0x3F, 0xE0, 0x00, 0x30, 0x70, 0x00, 0x30, 0x30, 0x00,    // row 13 - 16
-        0x00, 0x30, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xF0, 0x00, 0x70, 0x30, 0x00,    // row 17 - 20
-        0x60, 0x30, 0x00, 0x60, 0x30, 0x00, 0x70, 0xF0, 0x00, 0x3F, 0xBC, 0x00,    // row 21 - 24
-        0x1F, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_62[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 5 - 8
-        0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 9 - 12
-        0x33, 0xC0, 0x00, 0x37, 0xF0, 0x00, 0x3E, 0x78, 0x00, 0x38, 0x18, 0x00,    // row 13 - 16
-        0x30, 0x1C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00,    // row 17 - 20
-        0x30, 0x1C, 0x00, 0x38, 0x18, 0x00, 0x3E, 0x78, 0x00, 0x37, 0xF0, 0x00,    // row 21 - 24
-        0x33, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_63[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x07, 0x80, 0x1F, 0xE0, 0x3C, 0xE0, 0x30, 0x30, 0x70, 0x00, 0x60, 0x00,    // row 13 - 18
-        0x60, 0x00, 0x60, 0x00, 0x70, 0x30, 0x30, 0x30, 0x3C, 0xE0, 0x1F, 0xE0,    // row 19 - 24
-        0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_64[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x18, 0x00,    // row 5 - 8
-        0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,    // row 9 - 12
-        0x07, 0x98, 0x00, 0x1F, 0xD8, 0x00, 0x3C, 0xF8, 0x00, 0x30, 0x38, 0x00,    // row 13 - 16
-        0x70, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00,    // row 17 - 20
-        0x70, 0x18, 0x00, 0x30, 0x38, 0x00, 0x3C, 0xF8, 0x00, 0x1F, 0xD8, 0x00,    // row 21 - 24
-        0x07, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_65[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 9 - 12
-        0x07, 0x80, 0x00, 0x1F, 0xE0, 0x00, 0x3C, 0xF0, 0x00, 0x30, 0x30, 0x00,    // row 13 - 16
-        0x70, 0x18, 0x00, 0x7F, 0xF8, 0x00, 0x7F, 0xF8, 0x00, 0x60, 0x00, 0x00,    // row 17 - 20
-        0x70, 0x00, 0x00, 0x30, 0x38, 0x00, 0x3C, 0xF0, 0x00, 0x1F, 0xE0, 0x00,    // row 21 - 24
-        0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_66[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x1E, 0x00, 0x3E, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 7 - 12
-        0xFE, 0x00, 0xFE, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 13 - 18
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 19 - 24
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_67[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 9 - 12
-        0x07, 0x98, 0x00, 0x1F, 0xD8, 0x00, 0x3C, 0xF8, 0x00, 0x30, 0x38, 0x00,    // row 13 - 16
-        0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00,    // row 17 - 20
-        0x70, 0x18, 0x00, 0x30, 0x38, 0x00, 0x3C, 0xF8, 0x00, 0x1F, 0xD8, 0x00,    // row 21 - 24
-        0x07, 0x98, 0x00, 0x00, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x38, 0x00,    // row 25 - 28
-        0x38, 0x70, 0x00, 0x3F, 0xF0, 0x00, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_68[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 5 - 8
-        0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 9 - 12
-        0x33, 0xE0, 0x00, 0x37, 0xF0, 0x00, 0x3C, 0x38, 0x00, 0x38, 0x18, 0x00,    // row 13 - 16
-        0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00,    // row 17 - 20
-        0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00,    // row 21 - 24
-        0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_69[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 13 - 18
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 19 - 24
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_6A[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 13 - 18
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 19 - 24
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0xF0, 0x00,    // row 25 - 30
-        0xE0, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_6B[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 7 - 12
-        0x30, 0x70, 0x30, 0xE0, 0x31, 0xC0, 0x33, 0x80, 0x37, 0x00, 0x3F, 0x00,    // row 13 - 18
-        0x3F, 0x80, 0x39, 0x80, 0x31, 0xC0, 0x30, 0xC0, 0x30, 0xE0, 0x30, 0x60,    // row 19 - 24
-        0x30, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_6C[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 7 - 12
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 13 - 18
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 19 - 24
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_6D[] =        // 4 bytes per row
-{
-           // row 1 - 3
-           // row 4 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 9
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 10 - 12
-        0x33, 0xC3, 0xC0, 0x00, 0x37, 0xEF, 0xE0, 0x00, 0x3C, 0x7C, 0x70, 0x00,    // row 13 - 15
-        0x38, 0x38, 0x30, 0x00, 0x30, 0x30, 0x30, 0x00, 0x30, 0x30, 0x30, 0x00,    // row 16 - 18
-        0x30, 0x30, 0x30, 0x00, 0x30, 0x30, 0x30, 0x00, 0x30, 0x30, 0x30, 0x00,    // row 19 - 21
-        0x30, 0x30, 0x30, 0x00, 0x30, 0x30, 0x30, 0x00, 0x30, 0x30, 0x30, 0x00,    // row 22 - 24
-        0x30, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 27
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 28 - 30
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00                             // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_6E[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 9 - 12
-        0x33, 0xE0, 0x00, 0x37, 0xF0, 0x00, 0x3C, 0x38, 0x00, 0x38, 0x18, 0x00,    // row 13 - 16
-        0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00,    // row 17 - 20
-        0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00,    // row 21 - 24
-        0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_6F[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 9 - 12
-        0x07, 0xC0, 0x00, 0x1F, 0xF0, 0x00, 0x3C, 0x78, 0x00, 0x30, 0x18, 0x00,    // row 13 - 16
-        0x70, 0x1C, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00, 0x60, 0x0C, 0x00,    // row 17 - 20
-        0x70, 0x1C, 0x00, 0x30, 0x18, 0x00, 0x3C, 0x78, 0x00, 0x1F, 0xF0, 0x00,    // row 21 - 24
-        0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_70[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 9 - 12
-        0x33, 0xC0, 0x00, 0x37, 0xF0, 0x00, 0x3E, 0x78, 0x00, 0x38, 0x18, 0x00,    // row 13 - 16
-        0x30, 0x1C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00, 0x30, 0x0C, 0x00,    // row 17 - 20
-        0x30, 0x1C, 0x00, 0x38, 0x18, 0x00, 0x3E, 0x78, 0x00, 0x37, 0xF0, 0x00,    // row 21 - 24
-        0x33, 0xC0, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x30, 0x00, 0x00,    // row 25 - 28
-        0x30, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_71[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 9 - 12
-        0x07, 0x98, 0x00, 0x1F, 0xD8, 0x00, 0x3C, 0xF8, 0x00, 0x30, 0x38, 0x00,    // row 13 - 16
-        0x70, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00, 0x60, 0x18, 0x00,    // row 17 - 20
-        0x70, 0x18, 0x00, 0x30, 0x38, 0x00, 0x3C, 0xF8, 0x00, 0x1F, 0xD8, 0x00,    // row 21 - 24
-        0x07, 0x98, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00,    // row 25 - 28
-        0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_72[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x37, 0x00, 0x3F, 0x00, 0x38, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 13 - 18
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 19 - 24
-        0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_73[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x1F, 0x00, 0x3F, 0xC0, 0x70, 0xC0, 0x60, 0x60, 0x60, 0x00, 0x3E, 0x00,    // row 13 - 18
-        0x1F, 0xC0, 0x03, 0xE0, 0x00, 0x60, 0x60, 0x60, 0x70, 0xE0, 0x3F, 0xC0,    // row 19 - 24
-        0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_74[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 7 - 12
-        0xFC, 0x00, 0xFC, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00,    // row 13 - 18
-        0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x3C, 0x00,    // row 19 - 24
-        0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_75[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 9 - 12
-        0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00,    // row 13 - 16
-        0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00, 0x30, 0x18, 0x00,    // row 17 - 20
-        0x30, 0x18, 0x00, 0x30, 0x38, 0x00, 0x38, 0x78, 0x00, 0x1F, 0xD8, 0x00,    // row 21 - 24
-        0x0F, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_76[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0xC0, 0x60, 0xC0, 0x60, 0x60, 0xC0, 0x60, 0xC0, 0x60, 0xC0, 0x31, 0x80,    // row 13 - 18
-        0x31, 0x80, 0x31, 0x80, 0x1B, 0x00, 0x1B, 0x00, 0x1F, 0x00, 0x0E, 0x00,    // row 19 - 24
-        0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_77[] =         // 3 bytes per row
-{
-           // row 1 - 4
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 5 - 8
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 9 - 12
-        0xC1, 0xC1, 0x80, 0xC1, 0xC1, 0x80, 0xC1, 0x41, 0x80, 0x63, 0x63, 0x00,    // row 13 - 16
-        0x63, 0x63, 0x00, 0x63, 0x63, 0x00, 0x62, 0x23, 0x00, 0x36, 0x36, 0x00,    // row 17 - 20
-        0x36, 0x36, 0x00, 0x36, 0x36, 0x00, 0x1C, 0x1C, 0x00, 0x1C, 0x1C, 0x00,    // row 21 - 24
-        0x1C, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 28
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 29 - 32
-};
-PROGMEM const unsigned char chr_f32_78[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x60, 0x30, 0x70, 0x70, 0x30, 0x60, 0x18, 0xC0, 0x1D, 0xC0, 0x0F, 0x80,    // row 13 - 18
-        0x07, 0x00, 0x0F, 0x80, 0x1D, 0xC0, 0x18, 0xC0, 0x30, 0x60, 0x70, 0x70,    // row 19 - 24
-        0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_79[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0xE0, 0x38, 0x60, 0x30, 0x60, 0x30, 0x30, 0x60, 0x30, 0x60, 0x30, 0x60,    // row 13 - 18
-        0x18, 0xC0, 0x18, 0xC0, 0x18, 0xC0, 0x0D, 0x80, 0x0D, 0x80, 0x0D, 0x80,    // row 19 - 24
-        0x07, 0x00, 0x07, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0E, 0x00, 0x7C, 0x00,    // row 25 - 30
-        0x78, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_7A[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x7F, 0xE0, 0x7F, 0xE0, 0x00, 0xE0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,    // row 13 - 18
-        0x06, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0x7F, 0xE0,    // row 19 - 24
-        0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_7B[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x01, 0xE0, 0x03, 0x80, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,    // row 7 - 12
-        0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00,    // row 13 - 18
-        0x1C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,    // row 19 - 24
-        0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80,    // row 25 - 30
-        0x01, 0xE0, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_7C[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,    // row 7 - 12
-        0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,    // row 13 - 18
-        0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,    // row 19 - 24
-        0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,    // row 25 - 30
-        0x06, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_7D[] =         // 2 bytes per row
-{
-           // row 1 - 6
-        0x3C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,    // row 7 - 12
-        0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x03, 0x00,    // row 13 - 18
-        0x01, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00,    // row 19 - 24
-        0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x0E, 0x00,    // row 25 - 30
-        0x3C, 0x00, 0x00, 0x00                                                     // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_7E[] =        // 3 bytes per row
-{
-           // row 1 - 3
-           // row 4 - 6
-        0x00, 0x00, 0x00, 0x1E, 0x01, 0x00, 0x33, 0x01, 0x00,    // row 7 - 9
-        0x61, 0xC3, 0x00, 0x40, 0x66, 0x00, 0x40, 0x3C, 0x00,    // row 10 - 12
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 15
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 16 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 21
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 22 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 27
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 28 - 30
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00                             // row 31 - 32
-};
-PROGMEM const unsigned char chr_f32_7F[] =         // 1 byte per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00,    // row 1 - 11
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 12 - 22
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00           // row 23 - 32
-};
+// Runs of pixels across the rows: bit 7 set ink, clear background, length (b & 0x7F) + 1
 
-PROGMEM const unsigned char* const chrtbl_f32[96] =       // character pointer table
-{
-        chr_f32_20, chr_f32_21, chr_f32_22, chr_f32_23, chr_f32_24, chr_f32_25, chr_f32_26, chr_f32_27, 
-        chr_f32_28, chr_f32_29, chr_f32_2A, chr_f32_2B, chr_f32_2C, chr_f32_2D, chr_f32_2E, chr_f32_2F, 
-        chr_f32_30, chr_f32_31, chr_f32_32, chr_f32_33, chr_f32_34, chr_f32_35, chr_f32_36, chr_f32_37, 
-        chr_f32_38, chr_f32_39, chr_f32_3A, chr_f32_3B, chr_f32_3C, chr_f32_3D, chr_f32_3E, chr_f32_3F, 
-        chr_f32_40, chr_f32_41, chr_f32_42, chr_f32_43, chr_f32_44, chr_f32_45, chr_f32_46, chr_f32_47, 
-        chr_f32_48, chr_f32_49, chr_f32_4A, chr_f32_4B, chr_f32_4C, chr_f32_4D, chr_f32_4E, chr_f32_4F, 
-        chr_f32_50, chr_f32_51, chr_f32_52, chr_f32_53, chr_f32_54, chr_f32_55, chr_f32_56, chr_f32_57, 
-        chr_f32_58, chr_f32_59, chr_f32_5A, chr_f32_5B, chr_f32_5C, chr_f32_5D, chr_f32_5E, chr_f32_5F, 
-        chr_f32_60, chr_f32_61, chr_f32_62, chr_f32_63, chr_f32_64, chr_f32_65, chr_f32_66, chr_f32_67, 
-        chr_f32_68, chr_f32_69, chr_f32_6A, chr_f32_6B, chr_f32_6C, chr_f32_6D, chr_f32_6E, chr_f32_6F, 
-        chr_f32_70, chr_f32_71, chr_f32_72, chr_f32_73, chr_f32_74, chr_f32_75, chr_f32_76, chr_f32_77, 
-        chr_f32_78, chr_f32_79, chr_f32_7A, chr_f32_7B, chr_f32_7C, chr_f32_7D, chr_f32_7E, chr_f32_7F
+PROGMEM const unsigned char chrdat_f32[4599] =
+{
+  // 0x21 '!', offset 0
+  0x0D, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81,
+  0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x1E, 0x81, 0x08, 0x81, 0x08, 0x81,
+  0x52,
+  // 0x22 '"', offset 33
+  0x0C, 0x80, 0x01, 0x80, 0x06, 0x80, 0x01, 0x80, 0x06, 0x80, 0x01, 0x80, 0x06, 0x80, 0x01, 0x80,
+  0x06, 0x80, 0x01, 0x80, 0x06, 0x80, 0x01, 0x80, 0x06, 0x80, 0x01, 0x80, 0x7F, 0x4A,
+  // 0x23 '#', offset 63
+  0x34, 0x81, 0x01, 0x81, 0x0F, 0x80, 0x02, 0x80, 0x10, 0x80, 0x02, 0x80, 0x0F, 0x81, 0x01, 0x81,
+  0x0F, 0x80, 0x02, 0x80, 0x10, 0x80, 0x02, 0x80, 0x0B, 0x8D, 0x0B, 0x80, 0x02, 0x80, 0x10, 0x80,
+  0x02, 0x80, 0x10, 0x80, 0x02, 0x80, 0x0B, 0x8D, 0x0B, 0x80, 0x02, 0x80, 0x10, 0x80, 0x02, 0x80,
+  0x0F, 0x81, 0x01, 0x81, 0x0F, 0x80, 0x02, 0x80, 0x10, 0x80, 0x02, 0x80, 0x0F, 0x81, 0x01, 0x81,
+  0x7F, 0x25,
+  // 0x24 '$', offset 129
+  0x25, 0x85, 0x08, 0x89, 0x06, 0x82, 0x03, 0x82, 0x05, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81,
+  0x04, 0x81, 0x0E, 0x82, 0x0E, 0x81, 0x0D, 0x87, 0x0A, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81,
+  0x0D, 0x81, 0x0E, 0x86, 0x02, 0x80, 0x04, 0x8B, 0x04, 0x81, 0x04, 0x83, 0x7B,
+  // 0x25 '%', offset 174
+  0x33, 0x82, 0x07, 0x81, 0x08, 0x86, 0x05, 0x80, 0x09, 0x81, 0x02, 0x81, 0x04, 0x81, 0x08, 0x81,
+  0x04, 0x81, 0x02, 0x81, 0x09, 0x81, 0x04, 0x81, 0x02, 0x80, 0x0A, 0x81, 0x04, 0x81, 0x01, 0x81,
+  0x0B, 0x81, 0x02, 0x81, 0x02, 0x80, 0x0C, 0x86, 0x01, 0x80, 0x0F, 0x82, 0x02, 0x81, 0x02, 0x82,
+  0x0F, 0x80, 0x01, 0x86, 0x0C, 0x80, 0x02, 0x81, 0x02, 0x81, 0x0B, 0x81, 0x01, 0x81, 0x04, 0x81,
+  0x0A, 0x80, 0x02, 0x81, 0x04, 0x81, 0x09, 0x81, 0x02, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81,
+  0x02, 0x81, 0x09, 0x80, 0x05, 0x86, 0x08, 0x81, 0x07, 0x82, 0x0A, 0x80, 0x7F, 0x21,
+  // 0x26 '&', offset 268
+  0x18, 0x84, 0x0D, 0x86, 0x0B, 0x82, 0x02, 0x82, 0x0A, 0x81, 0x04, 0x81, 0x0A, 0x81, 0x04, 0x81,
+  0x0A, 0x81, 0x03, 0x82, 0x0B, 0x81, 0x01, 0x82, 0x0D, 0x84, 0x0D, 0x83, 0x0E, 0x85, 0x03, 0x81,
+  0x06, 0x82, 0x01, 0x82, 0x02, 0x81, 0x05, 0x82, 0x03, 0x82, 0x01, 0x81, 0x05, 0x81, 0x05, 0x84,
+  0x06, 0x81, 0x06, 0x83, 0x06, 0x81, 0x07, 0x81, 0x07, 0x82, 0x04, 0x85, 0x06, 0x88, 0x01, 0x82,
+  0x06, 0x85, 0x04, 0x82, 0x7F, 0x0E,
+  // 0x27 ''', offset 338
+  0x09, 0x82, 0x05, 0x82, 0x05, 0x82, 0x07, 0x80, 0x06, 0x81, 0x05, 0x81, 0x7F, 0x30,
+  // 0x28 '(', offset 352
+  0x10, 0x81, 0x08, 0x80, 0x08, 0x81, 0x08, 0x80, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x07, 0x81,
+  0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81,
+  0x08, 0x81, 0x09, 0x81, 0x08, 0x81, 0x08, 0x81, 0x09, 0x80, 0x09, 0x81, 0x09, 0x80, 0x09, 0x81,
+  0x0D,
+  // 0x29 ')', offset 401
+  0x0A, 0x81, 0x09, 0x80, 0x09, 0x81, 0x09, 0x80, 0x09, 0x81, 0x08, 0x81, 0x08, 0x81, 0x09, 0x81,
+  0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81,
+  0x08, 0x81, 0x07, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x80, 0x08, 0x81, 0x08, 0x80, 0x08, 0x81,
+  0x13,
+  // 0x2A '*', offset 450
+  0x13, 0x81, 0x0C, 0x81, 0x0C, 0x81, 0x09, 0x80, 0x01, 0x81, 0x01, 0x80, 0x05, 0x89, 0x06, 0x85,
+  0x09, 0x83, 0x09, 0x81, 0x01, 0x81, 0x07, 0x82, 0x01, 0x82, 0x07, 0x80, 0x03, 0x80, 0x7F, 0x66,
+  // 0x2B '+', offset 482
+  0x6B, 0x81, 0x0A, 0x81, 0x0A, 0x81, 0x07, 0x87, 0x04, 0x87, 0x07, 0x81, 0x0A, 0x81, 0x0A, 0x81,
+  0x7F, 0x08,
+  // 0x2C ',', offset 500
+  0x7F, 0x21, 0x82, 0x06, 0x82, 0x06, 0x82, 0x08, 0x80, 0x07, 0x81, 0x07, 0x80, 0x07, 0x81, 0x23,
+  // 0x2D '-', offset 516
+  0x79, 0x85, 0x04, 0x85, 0x7F, 0x12,
+  // 0x2E '.', offset 522
+  0x7F, 0x21, 0x82, 0x06, 0x82, 0x06, 0x82, 0x4A,
+  // 0x2F '/', offset 530
+  0x10, 0x81, 0x08, 0x81, 0x08, 0x80, 0x08, 0x81, 0x08, 0x81, 0x08, 0x80, 0x08, 0x81, 0x08, 0x81,
+  0x08, 0x80, 0x08, 0x81, 0x08, 0x81, 0x08, 0x80, 0x08, 0x81, 0x08, 0x81, 0x08, 0x80, 0x08, 0x81,
+  0x08, 0x81, 0x08, 0x80, 0x08, 0x81, 0x08, 0x81, 0x3F,
+  // 0x30 '0', offset 571
+  0x26, 0x83, 0x0A, 0x87, 0x07, 0x83, 0x01, 0x83, 0x06, 0x81, 0x05, 0x81, 0x05, 0x82, 0x05, 0x82,
+  0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81,
+  0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81, 0x04, 0x82, 0x05, 0x82,
+  0x05, 0x81, 0x05, 0x81, 0x06, 0x83, 0x01, 0x83, 0x07, 0x87, 0x0A, 0x83, 0x7E,
+  // 0x31 '1', offset 632
+  0x28, 0x81, 0x0E, 0x81, 0x0D, 0x82, 0x0A, 0x85, 0x0A, 0x85, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81,
+  0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81,
+  0x0E, 0x81, 0x7E,
+  // 0x32 '2', offset 667
+  0x25, 0x85, 0x08, 0x89, 0x06, 0x82, 0x03, 0x82, 0x05, 0x82, 0x06, 0x81, 0x04, 0x81, 0x07, 0x81,
+  0x04, 0x81, 0x07, 0x81, 0x0E, 0x81, 0x0D, 0x82, 0x0B, 0x83, 0x0A, 0x84, 0x09, 0x84, 0x0A, 0x83,
+  0x0B, 0x82, 0x0C, 0x82, 0x0D, 0x81, 0x0E, 0x8B, 0x04, 0x8B, 0x7A,
+  // 0x33 '3', offset 710
+  0x25, 0x85, 0x09, 0x87, 0x07, 0x82, 0x03, 0x82, 0x06, 0x81, 0x05, 0x81, 0x05, 0x82, 0x05, 0x81,
+  0x0E, 0x81, 0x0D, 0x82, 0x0A, 0x84, 0x0B, 0x85, 0x0E, 0x82, 0x0E, 0x81, 0x04, 0x81, 0x07, 0x81,
+  0x04, 0x81, 0x07, 0x81, 0x04, 0x82, 0x05, 0x82, 0x05, 0x82, 0x03, 0x82, 0x06, 0x89, 0x08, 0x85,
+  0x7D,
+  // 0x34 '4', offset 759
+  0x2A, 0x81, 0x0D, 0x82, 0x0C, 0x83, 0x0C, 0x83, 0x0B, 0x81, 0x00, 0x81, 0x0A, 0x81, 0x01, 0x81,
+  0x09, 0x81, 0x02, 0x81, 0x09, 0x81, 0x02, 0x81, 0x08, 0x81, 0x03, 0x81, 0x07, 0x81, 0x04, 0x81,
+  0x06, 0x81, 0x05, 0x81, 0x06, 0x8B, 0x04, 0x8B, 0x0C, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81,
+  0x7C,
+  // 0x35 '5', offset 808
+  0x23, 0x89, 0x06, 0x89, 0x06, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x00, 0x84, 0x08, 0x89,
+  0x05, 0x83, 0x03, 0x82, 0x05, 0x81, 0x06, 0x82, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x04, 0x81,
+  0x07, 0x81, 0x04, 0x82, 0x05, 0x82, 0x05, 0x82, 0x03, 0x82, 0x06, 0x89, 0x08, 0x85, 0x7D,
+  // 0x36 '6', offset 855
+  0x26, 0x84, 0x09, 0x88, 0x06, 0x82, 0x04, 0x81, 0x06, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81,
+  0x04, 0x81, 0x0E, 0x81, 0x01, 0x84, 0x07, 0x8A, 0x05, 0x83, 0x03, 0x82, 0x05, 0x82, 0x05, 0x82,
+  0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81, 0x05, 0x81, 0x05, 0x82,
+  0x05, 0x82, 0x03, 0x82, 0x07, 0x88, 0x08, 0x85, 0x7D,
+  // 0x37 '7', offset 912
+  0x22, 0x8B, 0x04, 0x8B, 0x0D, 0x81, 0x0D, 0x82, 0x0C, 0x82, 0x0D, 0x81, 0x0D, 0x82, 0x0D, 0x81,
+  0x0D, 0x81, 0x0E, 0x81, 0x0D, 0x82, 0x0D, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0D, 0x81, 0x0E, 0x81,
+  0x0E, 0x81, 0x7F, 0x01,
+  // 0x38 '8', offset 948
+  0x26, 0x83, 0x0A, 0x87, 0x08, 0x81, 0x03, 0x81, 0x07, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81,
+  0x06, 0x81, 0x05, 0x81, 0x07, 0x81, 0x03, 0x81, 0x09, 0x85, 0x09, 0x87, 0x07, 0x82, 0x03, 0x82,
+  0x05, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81,
+  0x05, 0x82, 0x03, 0x82, 0x06, 0x89, 0x08, 0x85, 0x7D,
+  // 0x39 '9', offset 1005
+  0x25, 0x85, 0x08, 0x88, 0x07, 0x82, 0x03, 0x82, 0x05, 0x82, 0x05, 0x81, 0x05, 0x81, 0x07, 0x81,
+  0x04, 0x81, 0x07, 0x81, 0x04, 0x81, 0x07, 0x81, 0x04, 0x82, 0x05, 0x82, 0x05, 0x82, 0x03, 0x83,
+  0x05, 0x8A, 0x07, 0x84, 0x01, 0x81, 0x0E, 0x81, 0x04, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x04, 0x82, 0x06, 0x88, 0x08, 0x86, 0x7D,
+  // 0x3A ':', offset 1062
+  0x3D, 0x82, 0x06, 0x82, 0x06, 0x82, 0x4C, 0x82, 0x06, 0x82, 0x06, 0x82, 0x4A,
+  // 0x3B ';', offset 1075
+  0x3D, 0x82, 0x06, 0x82, 0x06, 0x82, 0x4C, 0x82, 0x06, 0x82, 0x06, 0x82, 0x08, 0x80, 0x07, 0x81,
+  0x07, 0x80, 0x07, 0x81, 0x23,
+  // 0x3C '<', offset 1096
+  0x7F, 0x00, 0x82, 0x0B, 0x82, 0x0A, 0x83, 0x0A, 0x82, 0x0B, 0x81, 0x10, 0x82, 0x10, 0x82, 0x0F,
+  0x82, 0x0F, 0x82, 0x7F, 0x2D,
+  // 0x3D '=', offset 1117
+  0x6C, 0x86, 0x04, 0x86, 0x1C, 0x86, 0x04, 0x86, 0x7F, 0x07,
+  // 0x3E '>', offset 1127
+  0x77, 0x82, 0x0F, 0x82, 0x0F, 0x83, 0x0F, 0x82, 0x10, 0x81, 0x0B, 0x82, 0x0A, 0x83, 0x0A, 0x82,
+  0x0B, 0x82, 0x7F, 0x36,
+  // 0x3F '?', offset 1147
+  0x13, 0x85, 0x07, 0x88, 0x06, 0x82, 0x03, 0x82, 0x04, 0x82, 0x05, 0x81, 0x04, 0x81, 0x06, 0x81,
+  0x04, 0x81, 0x06, 0x81, 0x0C, 0x82, 0x0B, 0x82, 0x0B, 0x82, 0x0B, 0x82, 0x0C, 0x81, 0x0C, 0x82,
+  0x0C, 0x82, 0x2C, 0x82, 0x0C, 0x82, 0x0C, 0x82, 0x77,
+  // 0x40 '@', offset 1188
+  0x24, 0x88, 0x10, 0x82, 0x06, 0x82, 0x0C, 0x82, 0x0A, 0x81, 0x0A, 0x81, 0x0D, 0x81, 0x08, 0x81,
+  0x0F, 0x81, 0x07, 0x80, 0x06, 0x83, 0x01, 0x80, 0x03, 0x81, 0x05, 0x81, 0x04, 0x81, 0x02, 0x83,
+  0x03, 0x81, 0x05, 0x81, 0x03, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81, 0x04, 0x81,
+  0x04, 0x81, 0x04, 0x81, 0x03, 0x81, 0x05, 0x81, 0x04, 0x81, 0x04, 0x81, 0x03, 0x81, 0x05, 0x81,
+  0x04, 0x81, 0x04, 0x81, 0x03, 0x81, 0x04, 0x81, 0x04, 0x81, 0x05, 0x81, 0x03, 0x81, 0x04, 0x81,
+  0x04, 0x81, 0x05, 0x81, 0x03, 0x81, 0x04, 0x81, 0x03, 0x81, 0x07, 0x81, 0x03, 0x81, 0x02, 0x82,
+  0x02, 0x81, 0x08, 0x81, 0x04, 0x83, 0x01, 0x84, 0x0A, 0x81, 0x1A, 0x81, 0x1A, 0x81, 0x0B, 0x81,
+  0x0C, 0x82, 0x05, 0x83, 0x10, 0x87, 0x7B,
+  // 0x41 'A', offset 1307
+  0x18, 0x83, 0x0E, 0x83, 0x0E, 0x83, 0x0D, 0x81, 0x01, 0x81, 0x0C, 0x81, 0x01, 0x81, 0x0C, 0x81,
+  0x01, 0x81, 0x0B, 0x81, 0x03, 0x81, 0x0A, 0x81, 0x03, 0x81, 0x0A, 0x81, 0x03, 0x81, 0x09, 0x81,
+  0x05, 0x81, 0x08, 0x81, 0x05, 0x81, 0x08, 0x89, 0x07, 0x8B, 0x06, 0x81, 0x07, 0x81, 0x06, 0x81,
+  0x07, 0x81, 0x05, 0x81, 0x09, 0x81, 0x04, 0x81, 0x09, 0x81, 0x03, 0x82, 0x09, 0x82, 0x7F, 0x07,
+  // 0x42 'B', offset 1371
+  0x15, 0x8A, 0x08, 0x8C, 0x06, 0x81, 0x07, 0x82, 0x06, 0x81, 0x08, 0x81, 0x06, 0x81, 0x08, 0x81,
+  0x06, 0x81, 0x08, 0x81, 0x06, 0x81, 0x08, 0x81, 0x06, 0x81, 0x07, 0x82, 0x06, 0x8A, 0x08, 0x8C,
+  0x06, 0x81, 0x07, 0x82, 0x06, 0x81, 0x09, 0x81, 0x05, 0x81, 0x09, 0x81, 0x05, 0x81, 0x09, 0x81,
+  0x05, 0x81, 0x09, 0x81, 0x05, 0x81, 0x07, 0x82, 0x06, 0x8C, 0x06, 0x8A, 0x7F, 0x12,
+  // 0x43 'C', offset 1433
+  0x1A, 0x86, 0x0B, 0x8A, 0x08, 0x83, 0x04, 0x83, 0x06, 0x82, 0x08, 0x81, 0x06, 0x81, 0x0A, 0x81,
+  0x04, 0x82, 0x0A, 0x81, 0x04, 0x81, 0x12, 0x81, 0x12, 0x81, 0x12, 0x81, 0x12, 0x81, 0x12, 0x81,
+  0x0B, 0x81, 0x04, 0x82, 0x0A, 0x81, 0x05, 0x81, 0x09, 0x82, 0x05, 0x82, 0x08, 0x81, 0x07, 0x83,
+  0x04, 0x83, 0x08, 0x8A, 0x0B, 0x86, 0x7F, 0x1A,
+  // 0x44 'D', offset 1489
+  0x16, 0x89, 0x0A, 0x8B, 0x08, 0x81, 0x06, 0x83, 0x07, 0x81, 0x08, 0x82, 0x06, 0x81, 0x09, 0x81,
+  0x06, 0x81, 0x09, 0x82, 0x05, 0x81, 0x0A, 0x81, 0x05, 0x81, 0x0A, 0x81, 0x05, 0x81, 0x0A, 0x81,
+  0x05, 0x81, 0x0A, 0x81, 0x05, 0x81, 0x0A, 0x81, 0x05, 0x81, 0x0A, 0x81, 0x05, 0x81, 0x09, 0x82,
+  0x05, 0x81, 0x09, 0x81, 0x06, 0x81, 0x08, 0x82, 0x06, 0x81, 0x06, 0x83, 0x07, 0x8B, 0x08, 0x89,
+  0x7F, 0x1B,
+  // 0x45 'E', offset 1555
+  0x14, 0x8C, 0x05, 0x8C, 0x05, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81,
+  0x10, 0x8B, 0x06, 0x8B, 0x06, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81,
+  0x10, 0x8C, 0x05, 0x8C, 0x7F, 0x08,
+  // 0x46 'F', offset 1593
+  0x13, 0x8B, 0x05, 0x8B, 0x05, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81,
+  0x0F, 0x8A, 0x06, 0x8A, 0x06, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81,
+  0x0F, 0x81, 0x0F, 0x81, 0x7F, 0x0B,
+  // 0x47 'G', offset 1631
+  0x1B, 0x86, 0x0C, 0x8A, 0x09, 0x82, 0x05, 0x83, 0x07, 0x82, 0x08, 0x81, 0x07, 0x81, 0x09, 0x82,
+  0x05, 0x82, 0x12, 0x81, 0x13, 0x81, 0x13, 0x81, 0x05, 0x87, 0x05, 0x81, 0x05, 0x87, 0x05, 0x81,
+  0x0B, 0x81, 0x05, 0x81, 0x0B, 0x81, 0x05, 0x82, 0x0A, 0x81, 0x06, 0x81, 0x09, 0x82, 0x06, 0x82,
+  0x07, 0x83, 0x07, 0x83, 0x04, 0x84, 0x08, 0x89, 0x00, 0x81, 0x0A, 0x85, 0x03, 0x80, 0x7F, 0x1E,
+  // 0x48 'H', offset 1695
+  0x16, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81,
+  0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x8D, 0x06, 0x8D,
+  0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81,
+  0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81,
+  0x06, 0x81, 0x09, 0x81, 0x7F, 0x17,
+  // 0x49 'I', offset 1765
+  0x0A, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x43,
+  // 0x4A 'J', offset 1802
+  0x18, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81,
+  0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x04, 0x81, 0x06, 0x81, 0x04, 0x81, 0x06, 0x81,
+  0x04, 0x81, 0x06, 0x81, 0x04, 0x82, 0x04, 0x82, 0x05, 0x88, 0x07, 0x86, 0x76,
+  // 0x4B 'K', offset 1847
+  0x15, 0x81, 0x08, 0x82, 0x05, 0x81, 0x07, 0x82, 0x06, 0x81, 0x06, 0x82, 0x07, 0x81, 0x05, 0x82,
+  0x08, 0x81, 0x04, 0x82, 0x09, 0x81, 0x03, 0x82, 0x0A, 0x81, 0x02, 0x82, 0x0B, 0x81, 0x01, 0x82,
+  0x0C, 0x81, 0x00, 0x83, 0x0C, 0x87, 0x0B, 0x83, 0x01, 0x82, 0x0A, 0x82, 0x03, 0x82, 0x09, 0x81,
+  0x05, 0x81, 0x09, 0x81, 0x05, 0x82, 0x08, 0x81, 0x06, 0x82, 0x07, 0x81, 0x07, 0x82, 0x06, 0x81,
+  0x08, 0x82, 0x05, 0x81, 0x09, 0x82, 0x7F, 0x0E,
+  // 0x4C 'L', offset 1919
+  0x11, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81,
+  0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81,
+  0x0D, 0x8A, 0x04, 0x8A, 0x72,
+  // 0x4D 'M', offset 1956
+  0x19, 0x82, 0x0A, 0x82, 0x06, 0x83, 0x08, 0x83, 0x06, 0x83, 0x08, 0x83, 0x06, 0x83, 0x08, 0x83,
+  0x06, 0x81, 0x00, 0x81, 0x06, 0x81, 0x00, 0x81, 0x06, 0x81, 0x00, 0x81, 0x06, 0x81, 0x00, 0x81,
+  0x06, 0x81, 0x00, 0x81, 0x06, 0x81, 0x00, 0x81, 0x06, 0x81, 0x01, 0x81, 0x04, 0x81, 0x01, 0x81,
+  0x06, 0x81, 0x01, 0x81, 0x04, 0x81, 0x01, 0x81, 0x06, 0x81, 0x01, 0x81, 0x04, 0x81, 0x01, 0x81,
+  0x06, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x06, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81,
+  0x06, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x06, 0x81, 0x03, 0x81, 0x00, 0x81, 0x03, 0x81,
+  0x06, 0x81, 0x03, 0x81, 0x00, 0x81, 0x03, 0x81, 0x06, 0x81, 0x03, 0x84, 0x03, 0x81, 0x06, 0x81,
+  0x04, 0x82, 0x04, 0x81, 0x06, 0x81, 0x04, 0x82, 0x04, 0x81, 0x7F, 0x2C,
+  // 0x4E 'N', offset 2080
+  0x16, 0x82, 0x08, 0x81, 0x06, 0x82, 0x08, 0x81, 0x06, 0x83, 0x07, 0x81, 0x06, 0x84, 0x06, 0x81,
+  0x06, 0x81, 0x00, 0x81, 0x06, 0x81, 0x06, 0x81, 0x00, 0x82, 0x05, 0x81, 0x06, 0x81, 0x01, 0x82,
+  0x04, 0x81, 0x06, 0x81, 0x02, 0x81, 0x04, 0x81, 0x06, 0x81, 0x02, 0x82, 0x03, 0x81, 0x06, 0x81,
+  0x03, 0x82, 0x02, 0x81, 0x06, 0x81, 0x04, 0x81, 0x02, 0x81, 0x06, 0x81, 0x04, 0x82, 0x01, 0x81,
+  0x06, 0x81, 0x05, 0x82, 0x00, 0x81, 0x06, 0x81, 0x06, 0x81, 0x00, 0x81, 0x06, 0x81, 0x06, 0x84,
+  0x06, 0x81, 0x07, 0x83, 0x06, 0x81, 0x08, 0x82, 0x06, 0x81, 0x08, 0x82, 0x7F, 0x17,
+  // 0x4F 'O', offset 2174
+  0x1B, 0x86, 0x0C, 0x8A, 0x09, 0x83, 0x04, 0x83, 0x07, 0x82, 0x08, 0x82, 0x06, 0x81, 0x0A, 0x81,
+  0x05, 0x82, 0x0A, 0x82, 0x04, 0x81, 0x0C, 0x81, 0x04, 0x81, 0x0C, 0x81, 0x04, 0x81, 0x0C, 0x81,
+  0x04, 0x81, 0x0C, 0x81, 0x04, 0x81, 0x0C, 0x81, 0x04, 0x81, 0x0C, 0x81, 0x04, 0x82, 0x0A, 0x82,
+  0x05, 0x81, 0x0A, 0x81, 0x06, 0x82, 0x08, 0x82, 0x07, 0x83, 0x04, 0x83, 0x09, 0x8A, 0x0C, 0x86,
+  0x7F, 0x22,
+  // 0x50 'P', offset 2240
+  0x14, 0x8A, 0x07, 0x8B, 0x06, 0x81, 0x07, 0x82, 0x05, 0x81, 0x08, 0x81, 0x05, 0x81, 0x08, 0x81,
+  0x05, 0x81, 0x08, 0x81, 0x05, 0x81, 0x08, 0x81, 0x05, 0x81, 0x07, 0x82, 0x05, 0x8B, 0x06, 0x8A,
+  0x07, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81,
+  0x7F, 0x13,
+  // 0x51 'Q', offset 2290
+  0x1B, 0x86, 0x0C, 0x8A, 0x09, 0x83, 0x04, 0x83, 0x07, 0x82, 0x08, 0x82, 0x06, 0x81, 0x0A, 0x81,
+  0x05, 0x82, 0x0A, 0x82, 0x04, 0x81, 0x0C, 0x81, 0x04, 0x81, 0x0C, 0x81, 0x04, 0x81, 0x0C, 0x81,
+  0x04, 0x81, 0x0C, 0x81, 0x04, 0x81, 0x0C, 0x81, 0x04, 0x81, 0x0C, 0x81, 0x04, 0x82, 0x06, 0x80,
+  0x02, 0x82, 0x05, 0x81, 0x05, 0x82, 0x01, 0x81, 0x06, 0x82, 0x05, 0x85, 0x07, 0x83, 0x04, 0x83,
+  0x09, 0x8C, 0x0A, 0x86, 0x01, 0x82, 0x13, 0x80, 0x7F, 0x08,
+  // 0x52 'R', offset 2364
+  0x15, 0x8B, 0x07, 0x8C, 0x06, 0x81, 0x08, 0x82, 0x05, 0x81, 0x09, 0x81, 0x05, 0x81, 0x09, 0x81,
+  0x05, 0x81, 0x09, 0x81, 0x05, 0x81, 0x09, 0x81, 0x05, 0x81, 0x08, 0x81, 0x06, 0x8C, 0x06, 0x8B,
+  0x07, 0x81, 0x07, 0x82, 0x06, 0x81, 0x08, 0x81, 0x06, 0x81, 0x08, 0x82, 0x05, 0x81, 0x09, 0x81,
+  0x05, 0x81, 0x09, 0x81, 0x05, 0x81, 0x09, 0x81, 0x05, 0x81, 0x09, 0x81, 0x05, 0x81, 0x09, 0x81,
+  0x7F, 0x0F,
+  // 0x53 'S', offset 2430
+  0x17, 0x85, 0x0A, 0x89, 0x07, 0x82, 0x05, 0x82, 0x06, 0x81, 0x07, 0x81, 0x06, 0x81, 0x07, 0x81,
+  0x06, 0x81, 0x07, 0x82, 0x05, 0x82, 0x10, 0x84, 0x0E, 0x86, 0x0E, 0x85, 0x0F, 0x83, 0x10, 0x82,
+  0x04, 0x82, 0x08, 0x81, 0x05, 0x81, 0x08, 0x81, 0x05, 0x81, 0x08, 0x81, 0x05, 0x83, 0x05, 0x82,
+  0x06, 0x8A, 0x09, 0x86, 0x7F, 0x0B,
+  // 0x54 'T', offset 2484
+  0x10, 0x8D, 0x02, 0x8D, 0x08, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81,
+  0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0x81,
+  0x0E, 0x81, 0x0E, 0x81, 0x7F,
+  // 0x55 'U', offset 2521
+  0x16, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81,
+  0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81,
+  0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81,
+  0x06, 0x81, 0x09, 0x81, 0x06, 0x81, 0x09, 0x81, 0x06, 0x82, 0x07, 0x82, 0x07, 0x82, 0x05, 0x82,
+  0x09, 0x89, 0x0B, 0x87, 0x7F, 0x1A,
+  // 0x56 'V', offset 2591
+  0x11, 0x82, 0x08, 0x82, 0x03, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81,
+  0x05, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x07, 0x81, 0x04, 0x81,
+  0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x09, 0x81, 0x02, 0x81, 0x0A, 0x81, 0x02, 0x81,
+  0x0A, 0x81, 0x02, 0x81, 0x0B, 0x81, 0x00, 0x81, 0x0C, 0x81, 0x00, 0x81, 0x0C, 0x84, 0x0D, 0x82,
+  0x0E, 0x82, 0x7F, 0x06,
+  // 0x57 'W', offset 2659
+  0x19, 0x82, 0x06, 0x82, 0x06, 0x82, 0x03, 0x81, 0x06, 0x82, 0x06, 0x81, 0x04, 0x81, 0x06, 0x82,
+  0x06, 0x81, 0x04, 0x82, 0x04, 0x81, 0x00, 0x81, 0x04, 0x82, 0x05, 0x81, 0x04, 0x81, 0x00, 0x81,
+  0x04, 0x81, 0x06, 0x81, 0x04, 0x81, 0x00, 0x81, 0x04, 0x81, 0x06, 0x81, 0x04, 0x81, 0x00, 0x81,
+  0x04, 0x81, 0x06, 0x82, 0x02, 0x81, 0x02, 0x81, 0x02, 0x82, 0x07, 0x81, 0x02, 0x81, 0x02, 0x81,
+  0x02, 0x81, 0x08, 0x81, 0x02, 0x81, 0x02, 0x81, 0x02, 0x81, 0x08, 0x81, 0x02, 0x81, 0x02, 0x81,
+  0x02, 0x81, 0x08, 0x82, 0x00, 0x81, 0x04, 0x81, 0x00, 0x82, 0x09, 0x81, 0x00, 0x81, 0x04, 0x81,
+  0x00, 0x81, 0x0A, 0x81, 0x00, 0x81, 0x04, 0x81, 0x00, 0x81, 0x0A, 0x81, 0x00, 0x81, 0x04, 0x81,
+  0x00, 0x81, 0x0A, 0x83, 0x06, 0x83, 0x0B, 0x82, 0x06, 0x82, 0x0C, 0x82, 0x06, 0x82, 0x7F, 0x3D,
+  // 0x58 'X', offset 2787
+  0x12, 0x81, 0x08, 0x81, 0x04, 0x82, 0x06, 0x82, 0x05, 0x81, 0x06, 0x81, 0x07, 0x81, 0x04, 0x81,
+  0x08, 0x82, 0x02, 0x82, 0x09, 0x81, 0x02, 0x81, 0x0B, 0x81, 0x00, 0x81, 0x0C, 0x84, 0x0D, 0x82,
+  0x0E, 0x82, 0x0D, 0x81, 0x00, 0x81, 0x0B, 0x82, 0x00, 0x82, 0x0A, 0x81, 0x02, 0x81, 0x09, 0x81,
+  0x04, 0x81, 0x07, 0x82, 0x04, 0x82, 0x06, 0x81, 0x06, 0x81, 0x05, 0x82, 0x06, 0x82, 0x03, 0x82,
+  0x08, 0x82, 0x7F, 0x00,
+  // 0x59 'Y', offset 2855
+  0x12, 0x82, 0x09, 0x82, 0x03, 0x82, 0x07, 0x82, 0x05, 0x81, 0x07, 0x81, 0x06, 0x82, 0x05, 0x82,
+  0x07, 0x81, 0x05, 0x81, 0x09, 0x81, 0x03, 0x81, 0x0A, 0x82, 0x01, 0x82, 0x0B, 0x81, 0x01, 0x81,
+  0x0D, 0x83, 0x0E, 0x83, 0x0F, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81, 0x10, 0x81,
+  0x10, 0x81, 0x10, 0x81, 0x7F, 0x0E,
+  // 0x5A 'Z', offset 2909
+  0x14, 0x8C, 0x05, 0x8C, 0x0F, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x82,
+  0x0E, 0x82, 0x0E, 0x82, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x82, 0x0E, 0x82, 0x0E, 0x82, 0x0E, 0x82,
+  0x0F, 0x8D, 0x04, 0x8D, 0x7F, 0x08,
+  // 0x5B '[', offset 2947
+  0x0E, 0x84, 0x06, 0x84, 0x06, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x84, 0x06, 0x84, 0x1B,
+  // 0x5C '\', offset 2994
+  0x01, 0x80, 0x0E, 0x80, 0x0E, 0x81, 0x0E, 0x80, 0x0E, 0x80, 0x0E, 0x81, 0x0E, 0x80, 0x0E, 0x80,
+  0x0E, 0x81, 0x0E, 0x80, 0x0E, 0x80, 0x0E, 0x81, 0x0E, 0x80, 0x0E, 0x80, 0x0E, 0x81, 0x0E, 0x80,
+  0x0E, 0x80, 0x0E, 0x81, 0x0E, 0x80, 0x0E, 0x80, 0x0E, 0x81, 0x0E, 0x80, 0x0E, 0x80, 0x0E, 0x81,
+  0x0E, 0x80, 0x14,
+  // 0x5D ']', offset 3045
+  0x0C, 0x84, 0x06, 0x84, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81,
+  0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x09, 0x81, 0x06, 0x84, 0x06, 0x84, 0x1D,
+  // 0x5E '^', offset 3092
+  0x13, 0x82, 0x0A, 0x81, 0x00, 0x81, 0x08, 0x81, 0x02, 0x81, 0x06, 0x81, 0x04, 0x81, 0x04, 0x81,
+  0x06, 0x81, 0x7F, 0x7F, 0x2E,
+  // 0x5F '_', offset 3113
+  0x7F, 0x7F, 0x5F, 0x8C, 0x32,
+  // 0x60 '`', offset 3118
+  0x0A, 0x81, 0x05, 0x81, 0x06, 0x80, 0x07, 0x82, 0x05, 0x82, 0x05, 0x82, 0x7F, 0x2F,
+  // 0x61 'a', offset 3132
+  0x69, 0x85, 0x08, 0x88, 0x07, 0x81, 0x04, 0x82, 0x06, 0x81, 0x05, 0x81, 0x0E, 0x81, 0x08, 0x87,
+  0x06, 0x89, 0x05, 0x82, 0x05, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x82,
+  0x03, 0x83, 0x06, 0x86, 0x00, 0x83, 0x05, 0x84, 0x02, 0x82, 0x79,
+  // 0x62 'b', offset 3175
+  0x13, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x01, 0x83, 0x09, 0x81,
+  0x00, 0x86, 0x07, 0x84, 0x01, 0x83, 0x06, 0x82, 0x05, 0x81, 0x06, 0x81, 0x06, 0x82, 0x05, 0x81,
+  0x07, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x06, 0x82, 0x05, 0x82,
+  0x05, 0x81, 0x06, 0x84, 0x01, 0x83, 0x06, 0x81, 0x00, 0x86, 0x07, 0x81, 0x01, 0x83, 0x7F, 0x05,
+  // 0x63 'c', offset 3239
+  0x64, 0x83, 0x09, 0x87, 0x06, 0x83, 0x01, 0x82, 0x06, 0x81, 0x05, 0x81, 0x04, 0x82, 0x0C, 0x81,
+  0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x82, 0x05, 0x81, 0x05, 0x81, 0x05, 0x81, 0x05, 0x83, 0x01, 0x82,
+  0x07, 0x87, 0x09, 0x83, 0x76,
+  // 0x64 'd', offset 3276
+  0x1C, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x09, 0x83, 0x01, 0x81, 0x07, 0x86,
+  0x00, 0x81, 0x06, 0x83, 0x01, 0x84, 0x06, 0x81, 0x05, 0x82, 0x05, 0x82, 0x06, 0x81, 0x05, 0x81,
+  0x07, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x82, 0x06, 0x81, 0x06, 0x81,
+  0x05, 0x82, 0x06, 0x83, 0x01, 0x84, 0x07, 0x86, 0x00, 0x81, 0x09, 0x83, 0x01, 0x81, 0x7F, 0x02,
+  // 0x65 'e', offset 3340
+  0x6A, 0x83, 0x0A, 0x87, 0x07, 0x83, 0x01, 0x83, 0x06, 0x81, 0x05, 0x81, 0x05, 0x82, 0x06, 0x81,
+  0x04, 0x8B, 0x04, 0x8B, 0x04, 0x81, 0x0E, 0x82, 0x0E, 0x81, 0x05, 0x82, 0x05, 0x83, 0x01, 0x83,
+  0x07, 0x87, 0x0A, 0x83, 0x7E,
+  // 0x66 'f', offset 3377
+  0x0D, 0x83, 0x05, 0x84, 0x05, 0x81, 0x08, 0x81, 0x08, 0x81, 0x06, 0x86, 0x03, 0x86, 0x05, 0x81,
+  0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81,
+  0x08, 0x81, 0x08, 0x81, 0x53,
+  // 0x67 'g', offset 3414
+  0x70, 0x83, 0x01, 0x81, 0x07, 0x86, 0x00, 0x81, 0x06, 0x83, 0x01, 0x84, 0x06, 0x81, 0x05, 0x82,
+  0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x07, 0x81,
+  0x05, 0x82, 0x06, 0x81, 0x06, 0x81, 0x05, 0x82, 0x06, 0x83, 0x01, 0x84, 0x07, 0x86, 0x00, 0x81,
+  0x09, 0x83, 0x01, 0x81, 0x0F, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x06, 0x82, 0x06, 0x82,
+  0x03, 0x82, 0x07, 0x89, 0x09, 0x85, 0x19,
+  // 0x68 'h', offset 3485
+  0x13, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x01, 0x84, 0x08, 0x81,
+  0x00, 0x86, 0x07, 0x83, 0x03, 0x82, 0x06, 0x82, 0x05, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x7F, 0x02,
+  // 0x69 'i', offset 3549
+  0x0A, 0x81, 0x06, 0x81, 0x06, 0x81, 0x18, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x43,
+  // 0x6A 'j', offset 3582
+  0x0A, 0x81, 0x06, 0x81, 0x06, 0x81, 0x18, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x04, 0x83, 0x04, 0x82, 0x0E,
+  // 0x6B 'k', offset 3627
+  0x1F, 0x81, 0x0C, 0x81, 0x0C, 0x81, 0x0C, 0x81, 0x0C, 0x81, 0x04, 0x82, 0x04, 0x81, 0x03, 0x82,
+  0x05, 0x81, 0x02, 0x82, 0x06, 0x81, 0x01, 0x82, 0x07, 0x81, 0x00, 0x82, 0x08, 0x85, 0x08, 0x86,
+  0x07, 0x82, 0x01, 0x81, 0x07, 0x81, 0x02, 0x82, 0x06, 0x81, 0x03, 0x81, 0x06, 0x81, 0x03, 0x82,
+  0x05, 0x81, 0x04, 0x81, 0x05, 0x81, 0x04, 0x82, 0x6B,
+  // 0x6D 'm', offset 3684
+  0x7F, 0x17, 0x81, 0x01, 0x83, 0x03, 0x83, 0x08, 0x81, 0x00, 0x85, 0x00, 0x86, 0x07, 0x83, 0x02,
+  0x84, 0x02, 0x82, 0x06, 0x82, 0x04, 0x82, 0x04, 0x81, 0x06, 0x81, 0x05, 0x81, 0x05, 0x81, 0x06,
+  0x81, 0x05, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x05,
+  0x81, 0x06, 0x81, 0x05, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05,
+  0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x05, 0x81, 0x7F,
+  0x33,
+  // 0x6E 'n', offset 3765
+  0x6D, 0x81, 0x01, 0x84, 0x08, 0x81, 0x00, 0x86, 0x07, 0x83, 0x03, 0x82, 0x06, 0x82, 0x05, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81, 0x06, 0x81,
+  0x06, 0x81, 0x06, 0x81, 0x7F, 0x02,
+  // 0x6F 'o', offset 3819
+  0x70, 0x84, 0x0A, 0x88, 0x07, 0x83, 0x02, 0x83, 0x06, 0x81, 0x06, 0x81, 0x05, 0x82, 0x06, 0x82,
+  0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x81, 0x08, 0x81, 0x04, 0x82, 0x06, 0x82,
+  0x05, 0x81, 0x06, 0x81, 0x06, 0x83, 0x02, 0x83, 0x07, 0x88, 0x0A, 0x84, 0x7F, 0x05,
+  // 0x70 'p', offset 3865
+  0x6D, 0x81, 0x01, 0x83, 0x09, 0x81, 0x00, 0x86, 0x07, 0x84, 0x01, 0x83, 0x06, 0x82, 0x05, 0x81,
+  0x06, 0x81, 0x06, 0x82, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x07, 0x81,
+  0x05, 0x81, 0x06, 0x82, 0x05, 0x82, 0x05, 0x81, 0x06, 0x84, 0x01, 0x83, 0x06, 0x81, 0x00, 0x86,
+  0x07, 0x81, 0x01, 0x83, 0x09, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x31,
+  // 0x71 'q', offset 3928
+  0x70, 0x83, 0x01, 0x81, 0x07, 0x86, 0x00, 0x81, 0x06, 0x83, 0x01, 0x84, 0x06, 0x81, 0x05, 0x82,
+  0x05, 0x82, 0x06, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x07, 0x81, 0x05, 0x81, 0x07, 0x81,
+  0x05, 0x82, 0x06, 0x81, 0x06, 0x81, 0x05, 0x82, 0x06, 0x83, 0x01, 0x84, 0x07, 0x86, 0x00, 0x81,
+  0x09, 0x83, 0x01, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x0F, 0x81, 0x28,
+  // 0x72 'r', offset 3991
+  0x43, 0x81, 0x00, 0x82, 0x04, 0x85, 0x04, 0x82, 0x07, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81,
+  0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x08, 0x81, 0x53,
+  // 0x73 's', offset 4020
+  0x5C, 0x84, 0x08, 0x87, 0x05, 0x82, 0x03, 0x81, 0x05, 0x81, 0x05, 0x81, 0x04, 0x81, 0x0D, 0x84,
+  0x0A, 0x86, 0x0A, 0x84, 0x0C, 0x81, 0x04, 0x81, 0x05, 0x81, 0x04, 0x82, 0x03, 0x82, 0x05, 0x87,
+  0x07, 0x85, 0x6E,
+  // 0x74 't', offset 4055
+  0x15, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x05, 0x85, 0x03, 0x85, 0x05, 0x81, 0x07, 0x81,
+  0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x81, 0x07, 0x83,
+  0x06, 0x82, 0x49,
+  // 0x75 'u', offset 4090
+  0x67, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81,
+  0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x06, 0x81,
+  0x05, 0x81, 0x06, 0x81, 0x05, 0x81, 0x05, 0x82, 0x05, 0x82, 0x03, 0x83, 0x06, 0x86, 0x00, 0x81,
+  0x07, 0x84, 0x01, 0x81, 0x7A,
+  // 0x76 'v', offset 4143
+  0x59, 0x81, 0x06, 0x81, 0x03, 0x81, 0x06, 0x81, 0x04, 0x81, 0x04, 0x81, 0x05, 0x81, 0x04, 0x81,
+  0x05, 0x81, 0x04, 0x81, 0x06, 0x81, 0x02, 0x81, 0x07, 0x81, 0x02, 0x81, 0x07, 0x81, 0x02, 0x81,
+  0x08, 0x81, 0x00, 0x81, 0x09, 0x81, 0x00, 0x81, 0x09, 0x84, 0x0A, 0x82, 0x0B, 0x82, 0x70,
+  // 0x77 'w', offset 4190
+  0x7D, 0x81, 0x04, 0x82, 0x04, 0x81, 0x03, 0x81, 0x04, 0x82, 0x04, 0x81, 0x03, 0x81, 0x04, 0x80,
+  0x00, 0x80, 0x04, 0x81, 0x04, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x05, 0x81, 0x02, 0x81,
+  0x00, 0x81, 0x02, 0x81, 0x05, 0x81, 0x02, 0x81, 0x00, 0x81, 0x02, 0x81, 0x05, 0x81, 0x02, 0x80,
+  0x02, 0x80, 0x02, 0x81, 0x06, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x07, 0x81, 0x00, 0x81,
+  0x02, 0x81, 0x00, 0x81, 0x07, 0x81, 0x00, 0x81, 0x02, 0x81, 0x00, 0x81, 0x08, 0x82, 0x04, 0x82,
+  0x09, 0x82, 0x04, 0x82, 0x09, 0x82, 0x04, 0x82, 0x7F, 0x19,
+  // 0x78 'x', offset 4280
+  0x60, 0x81, 0x06, 0x81, 0x04, 0x82, 0x04, 0x82, 0x05, 0x81, 0x04, 0x81, 0x07, 0x81, 0x02, 0x81,
+  0x08, 0x82, 0x00, 0x82, 0x09, 0x84, 0x0B, 0x82, 0x0B, 0x84, 0x09, 0x82, 0x00, 0x82, 0x08, 0x81,
+  0x02, 0x81, 0x07, 0x81, 0x04, 0x81, 0x05, 0x82, 0x04, 0x82, 0x04, 0x81, 0x06, 0x81, 0x73,
+  // 0x79 'y', offset 4327
+  0x5F, 0x82, 0x06, 0x82, 0x03, 0x81, 0x06, 0x81, 0x04, 0x81, 0x06, 0x81, 0x05, 0x81, 0x04, 0x81,
+  0x06, 0x81, 0x04, 0x81, 0x06, 0x81, 0x04, 0x81, 0x07, 0x81, 0x02, 0x81, 0x08, 0x81, 0x02, 0x81,
+  0x08, 0x81, 0x02, 0x81, 0x09, 0x81, 0x00, 0x81, 0x0A, 0x81, 0x00, 0x81, 0x0A, 0x81, 0x00, 0x81,
+  0x0B, 0x82, 0x0C, 0x82, 0x0C, 0x82, 0x0C, 0x81, 0x0C, 0x82, 0x09, 0x84, 0x0A, 0x83, 0x1A,
+  // 0x7A 'z', offset 4390
+  0x5A, 0x89, 0x04, 0x89, 0x0B, 0x82, 0x0A, 0x82, 0x0A, 0x82, 0x0A, 0x82, 0x0B, 0x81, 0x0B, 0x82,
+  0x0A, 0x82, 0x0A, 0x82, 0x0A, 0x82, 0x0B, 0x89, 0x04, 0x89, 0x6C,
+  // 0x7B '{', offset 4417
+  0x06, 0x83, 0x0A, 0x82, 0x0C, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81,
+  0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0C, 0x81, 0x0B, 0x82, 0x0E, 0x81, 0x0E, 0x81, 0x0D, 0x81,
+  0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x82,
+  0x0D, 0x83, 0x14,
+  // 0x7C '|', offset 4468
+  0x04, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81,
+  0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81,
+  0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81,
+  0x0D, 0x81, 0x18,
+  // 0x7D '}', offset 4519
+  0x01, 0x83, 0x0D, 0x82, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81,
+  0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0E, 0x81, 0x0E, 0x82, 0x0B, 0x81, 0x0C, 0x81, 0x0D, 0x81,
+  0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0D, 0x81, 0x0C, 0x82,
+  0x0A, 0x83, 0x19,
+  // 0x7E '~', offset 4570
+  0x14, 0x83, 0x07, 0x80, 0x03, 0x81, 0x01, 0x81, 0x06, 0x80, 0x02, 0x81, 0x03, 0x82, 0x03, 0x81,
+  0x02, 0x80, 0x06, 0x81, 0x01, 0x81, 0x03, 0x80, 0x07, 0x83, 0x7F, 0x7F, 0x6B
 };
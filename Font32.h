@@ -1,7 +1,10 @@
+#include <stdint.h>
+
 #define nr_chrs_f32 96
 #define chr_hgt_f32 26
 #define data_size_f32 8
 #define firstchr_f32 32
+#define enc_f32 1		// glyph encoding, SSD1322_FONT_RLE
 
-extern const unsigned char widtbl_f32[96];
-extern const unsigned char* const chrtbl_f32[96];
+extern const uint32_t idxtbl_f32[96];            // offset | width << 16, or SSD1322_GLYPH_BLANK
+extern const unsigned char chrdat_f32[];
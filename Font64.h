@@ -1,7 +1,10 @@
+#include <stdint.h>
+
 #define nr_chrs_f64 96
 #define chr_hgt_f64 48
 #define data_size_f64 8
 #define firstchr_f64 32
+#define enc_f64 1		// glyph encoding, SSD1322_FONT_RLE
 
-extern const unsigned char widtbl_f64[96];
-extern const unsigned char* const chrtbl_f64[96];
+extern const uint32_t idxtbl_f64[96];            // offset | width << 16, or SSD1322_GLYPH_BLANK
+extern const unsigned char chrdat_f64[];
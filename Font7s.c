@@ -1,4 +1,4 @@
-// Font size 7 is a 7 segment font intended to display numbers and time
+// Font size 7 is a 7 segment font intended to display numbers and time, run length encoded by ssd1322_font
 // This font only contains characters [space] 0 1 2 3 4 5 6 7 8 9 : .
 // All other characters print as a space
 
@@ -13,260 +13,120 @@
  #define PROGMEM
 #endif
 
-PROGMEM const unsigned char widtbl_f7s[96] =          // character width table
+PROGMEM const uint32_t idxtbl_f7s[96] =         // offset | width << 16, or SSD1322_GLYPH_BLANK
 {
-        12, 12, 12, 12, 12, 12, 12, 12,     // char 32 - 39
-        12, 12, 12, 12, 12, 12, 12, 12,     // char 40 - 47
-        32, 32, 32, 32, 32, 32, 32, 32,     // char 48 - 55
-        32, 32, 12, 12, 12, 12, 12, 12,     // char 56 - 63
-        12, 12, 12, 12, 12, 12, 12, 12,     // char 64 - 71
-        12, 12, 12, 12, 12, 12, 12, 12,     // char 72 - 79
-        12, 12, 12, 12, 12, 12, 12, 12,     // char 80 - 87
-        12, 12, 12, 12, 12, 12, 12, 12,     // char 88 - 95
-        12, 12, 12, 12, 12, 12, 12, 12,     // char 96 - 103
-        12, 12, 12, 12, 12, 12, 12, 12,     // char 104 - 111
-        12, 12, 12, 12, 12, 12, 12, 12,     // char 112 - 119
-        12, 12, 12, 12, 12, 12, 12, 12      // char 120 - 127
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000,
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x000C0000, 0x010C0000,
+  0x0020000E, 0x002000B7, 0x00200104, 0x0020016F, 0x002001D8, 0x00200253, 0x002002BA, 0x00200347,
+  0x0020039D, 0x00200450, 0x000C04DD, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000,
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000,
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000,
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000,
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000,
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000,
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000,
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000,
+  0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000, 0x010C0000
 };
 
-// Row format, MSB left
+// Runs of pixels across the rows: bit 7 set ink, clear background, length (b & 0x7F) + 1
 
-PROGMEM const unsigned char chr_f7s_20[96] =          // 2 bytes per row
+PROGMEM const unsigned char chrdat_f7s[1269] =
 {
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 31 - 36
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 37 - 42
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 43 - 48
-};
-PROGMEM const unsigned char chr_f7s_2E[96] =          // 2 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 31 - 36
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 37 - 42
-        0x0E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x00, 0x00     // row 43 - 48
-};
-PROGMEM const unsigned char chr_f7s_30[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,    // row 1 - 3
-        0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x20, 0x0C, 0xFF, 0xFE, 0x70,    // row 4 - 6
-        0x1E, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 7 - 9
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 10 - 12
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 13 - 15
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 16 - 18
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3E, 0x00, 0x00, 0xF8,    // row 19 - 21
-        0x38, 0x00, 0x00, 0x38, 0x20, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,    // row 22 - 24
-        0x20, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x18, 0x3E, 0x00, 0x00, 0x78,    // row 25 - 27
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 28 - 30
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 31 - 33
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 34 - 36
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 37 - 39
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x1E, 0x00, 0x00, 0xF0,    // row 40 - 42
-        0x0C, 0xFF, 0xFE, 0x60, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80,    // row 43 - 45
-        0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_31[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 1 - 3
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x70,    // row 4 - 6
-        0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 7 - 9
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 10 - 12
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 13 - 15
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 16 - 18
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x78,    // row 19 - 21
-        0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,    // row 22 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x78,    // row 25 - 27
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 28 - 30
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 31 - 33
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 34 - 36
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 37 - 39
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF0,    // row 40 - 42
-        0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 43 - 45
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_32[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,    // row 1 - 3
-        0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x20, 0x00, 0xFF, 0xFE, 0x70,    // row 4 - 6
-        0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 7 - 9
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 10 - 12
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 13 - 15
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 16 - 18
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF8,    // row 19 - 21
-        0x00, 0xFF, 0xFE, 0x38, 0x03, 0xFF, 0xFF, 0x88, 0x0F, 0xFF, 0xFF, 0xE0,    // row 22 - 24
-        0x27, 0xFF, 0xFF, 0xC0, 0x39, 0xFF, 0xFF, 0x00, 0x3E, 0x00, 0x00, 0x00,    // row 25 - 27
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 28 - 30
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 31 - 33
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 34 - 36
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 37 - 39
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,    // row 40 - 42
-        0x0C, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80,    // row 43 - 45
-        0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_33[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,    // row 1 - 3
-        0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x20, 0x00, 0xFF, 0xFE, 0x70,    // row 4 - 6
-        0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 7 - 9
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 10 - 12
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 13 - 15
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 16 - 18
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF8,    // row 19 - 21
-        0x00, 0xFF, 0xFE, 0x38, 0x03, 0xFF, 0xFF, 0x88, 0x0F, 0xFF, 0xFF, 0xE0,    // row 22 - 24
-        0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x78,    // row 25 - 27
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 28 - 30
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 31 - 33
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 34 - 36
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 37 - 39
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF0,    // row 40 - 42
-        0x00, 0xFF, 0xFE, 0x60, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80,    // row 43 - 45
-        0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_34[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 1 - 3
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x0C, 0x00, 0x00, 0x70,    // row 4 - 6
-        0x1E, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 7 - 9
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 10 - 12
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 13 - 15
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 16 - 18
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3E, 0x00, 0x00, 0xF8,    // row 19 - 21
-        0x38, 0xFF, 0xFE, 0x38, 0x23, 0xFF, 0xFF, 0x88, 0x0F, 0xFF, 0xFF, 0xE0,    // row 22 - 24
-        0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x78,    // row 25 - 27
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 28 - 30
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 31 - 33
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 34 - 36
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 37 - 39
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF0,    // row 40 - 42
-        0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 43 - 45
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_35[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,    // row 1 - 3
-        0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x0C, 0xFF, 0xFE, 0x00,    // row 4 - 6
-        0x1E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 7 - 9
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 10 - 12
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 13 - 15
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 16 - 18
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,    // row 19 - 21
-        0x38, 0xFF, 0xFE, 0x00, 0x23, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0,    // row 22 - 24
-        0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x78,    // row 25 - 27
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 28 - 30
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 31 - 33
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 34 - 36
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 37 - 39
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF0,    // row 40 - 42
-        0x00, 0xFF, 0xFE, 0x60, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80,    // row 43 - 45
-        0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_36[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,    // row 1 - 3
-        0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x00, 0x0C, 0xFF, 0xFE, 0x00,    // row 4 - 6
-        0x1E, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 7 - 9
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 10 - 12
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 13 - 15
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00,    // row 16 - 18
-        0x3F, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00,    // row 19 - 21
-        0x38, 0xFF, 0xFE, 0x00, 0x23, 0xFF, 0xFF, 0x80, 0x0F, 0xFF, 0xFF, 0xE0,    // row 22 - 24
-        0x27, 0xFF, 0xFF, 0xC0, 0x39, 0xFF, 0xFF, 0x18, 0x3E, 0x00, 0x00, 0x78,    // row 25 - 27
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 28 - 30
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 31 - 33
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 34 - 36
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 37 - 39
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x1E, 0x00, 0x00, 0xF0,    // row 40 - 42
-        0x0C, 0xFF, 0xFE, 0x60, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80,    // row 43 - 45
-        0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_37[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,    // row 1 - 3
-        0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x20, 0x00, 0xFF, 0xFE, 0x70,    // row 4 - 6
-        0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 7 - 9
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 10 - 12
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 13 - 15
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 16 - 18
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF8,    // row 19 - 21
-        0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00,    // row 22 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x78,    // row 25 - 27
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 28 - 30
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 31 - 33
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 34 - 36
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 37 - 39
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF0,    // row 40 - 42
-        0x00, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 43 - 45
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_38[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,    // row 1 - 3
-        0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x20, 0x0C, 0xFF, 0xFE, 0x70,    // row 4 - 6
-        0x1E, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 7 - 9
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 10 - 12
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 13 - 15
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 16 - 18
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3E, 0x00, 0x00, 0xF8,    // row 19 - 21
-        0x38, 0xFF, 0xFE, 0x38, 0x23, 0xFF, 0xFF, 0x88, 0x0F, 0xFF, 0xFF, 0xE0,    // row 22 - 24
-        0x27, 0xFF, 0xFF, 0xC0, 0x39, 0xFF, 0xFF, 0x18, 0x3E, 0x00, 0x00, 0x78,    // row 25 - 27
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 28 - 30
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 31 - 33
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 34 - 36
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 37 - 39
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x1E, 0x00, 0x00, 0xF0,    // row 40 - 42
-        0x0C, 0xFF, 0xFE, 0x60, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80,    // row 43 - 45
-        0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_39[192] =         // 4 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x01, 0xFF, 0xFF, 0x00,    // row 1 - 3
-        0x03, 0xFF, 0xFF, 0x80, 0x01, 0xFF, 0xFF, 0x20, 0x0C, 0xFF, 0xFE, 0x70,    // row 4 - 6
-        0x1E, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 7 - 9
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 10 - 12
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 13 - 15
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8,    // row 16 - 18
-        0x3F, 0x00, 0x01, 0xF8, 0x3F, 0x00, 0x01, 0xF8, 0x3E, 0x00, 0x00, 0xF8,    // row 19 - 21
-        0x38, 0xFF, 0xFE, 0x38, 0x23, 0xFF, 0xFF, 0x88, 0x0F, 0xFF, 0xFF, 0xE0,    // row 22 - 24
-        0x07, 0xFF, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x78,    // row 25 - 27
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 28 - 30
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 31 - 33
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 34 - 36
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8,    // row 37 - 39
-        0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x00, 0xF0,    // row 40 - 42
-        0x00, 0xFF, 0xFE, 0x60, 0x01, 0xFF, 0xFF, 0x00, 0x03, 0xFF, 0xFF, 0x80,    // row 43 - 45
-        0x01, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00     // row 46 - 48
-};
-PROGMEM const unsigned char chr_f7s_3A[96] =          // 2 bytes per row
-{
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 1 - 6
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 7 - 12
-        0x00, 0x00, 0x0E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0E, 0x00,    // row 13 - 18
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 19 - 24
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 25 - 30
-        0x0E, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x0E, 0x00, 0x00, 0x00,    // row 31 - 36
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,    // row 37 - 42
-        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00     // row 43 - 48
-};
-
-PROGMEM const unsigned char* const chrtbl_f7s[96] =        // character pointer table
-{
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, 
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_2E, chr_f7s_20, 
-        chr_f7s_30, chr_f7s_31, chr_f7s_32, chr_f7s_33, chr_f7s_34, chr_f7s_35, chr_f7s_36, chr_f7s_37, 
-        chr_f7s_38, chr_f7s_39, chr_f7s_3A, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20,
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20,
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20,
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20,
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20,
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, 
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, 
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20,
-        chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20, chr_f7s_20
+  // 0x2E '.', offset 0
+  0x7F, 0x7F, 0x7F, 0x7B, 0x82, 0x07, 0x84, 0x06, 0x84, 0x06, 0x84, 0x07, 0x82, 0x10,
+  // 0x30 '0', offset 14
+  0x27, 0x8E, 0x0F, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x01, 0x80, 0x08, 0x81, 0x01, 0x8E, 0x01, 0x82,
+  0x06, 0x83, 0x10, 0x84, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x84, 0x10, 0x84, 0x04, 0x82, 0x14, 0x82,
+  0x04, 0x80, 0x18, 0x80, 0x24, 0x80, 0x1E, 0x82, 0x15, 0x81, 0x04, 0x84, 0x11, 0x83, 0x04, 0x85,
+  0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85,
+  0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85,
+  0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85,
+  0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x05, 0x83, 0x10, 0x83, 0x07, 0x81, 0x01, 0x8E, 0x01, 0x81,
+  0x0B, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x0F, 0x8E, 0x28,
+  // 0x31 '1', offset 183
+  0x7F, 0x19, 0x80, 0x1D, 0x82, 0x1B, 0x84, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19,
+  0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19,
+  0x85, 0x1B, 0x83, 0x1D, 0x81, 0x1E, 0x80, 0x5D, 0x81, 0x1B, 0x83, 0x19, 0x85, 0x19, 0x85, 0x19,
+  0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19,
+  0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x1A, 0x83, 0x1C, 0x81, 0x7F, 0x24,
+  // 0x32 '2', offset 260
+  0x27, 0x8E, 0x0F, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x01, 0x80, 0x0C, 0x8E, 0x01, 0x82, 0x1B, 0x84,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x1A, 0x84, 0x0A, 0x8E, 0x02, 0x82,
+  0x08, 0x92, 0x02, 0x80, 0x06, 0x96, 0x06, 0x80, 0x01, 0x94, 0x07, 0x82, 0x01, 0x90, 0x09, 0x84,
+  0x1A, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x1A, 0x83, 0x1C, 0x81,
+  0x01, 0x8E, 0x0F, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x0F, 0x8E, 0x28,
+  // 0x33 '3', offset 367
+  0x27, 0x8E, 0x0F, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x01, 0x80, 0x0C, 0x8E, 0x01, 0x82, 0x1B, 0x84,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x1A, 0x84, 0x0A, 0x8E, 0x02, 0x82,
+  0x08, 0x92, 0x02, 0x80, 0x06, 0x96, 0x09, 0x94, 0x0C, 0x90, 0x02, 0x81, 0x1B, 0x83, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x1A, 0x83, 0x0B, 0x8E, 0x01, 0x81,
+  0x0B, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x0F, 0x8E, 0x28,
+  // 0x34 '4', offset 472
+  0x7F, 0x19, 0x80, 0x08, 0x81, 0x12, 0x82, 0x06, 0x83, 0x10, 0x84, 0x04, 0x85, 0x0E, 0x85, 0x04,
+  0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04,
+  0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04,
+  0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04,
+  0x84, 0x10, 0x84, 0x04, 0x82, 0x02, 0x8E, 0x02, 0x82, 0x04, 0x80, 0x02, 0x92, 0x02, 0x80, 0x06,
+  0x96, 0x09, 0x94, 0x0C, 0x90, 0x02, 0x81, 0x1B, 0x83, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19,
+  0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19,
+  0x85, 0x19, 0x85, 0x19, 0x85, 0x1A, 0x83, 0x1C, 0x81, 0x7F, 0x24,
+  // 0x35 '5', offset 595
+  0x27, 0x8E, 0x0F, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x0B, 0x81, 0x01, 0x8E, 0x0B, 0x83, 0x1A, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x84, 0x1A, 0x82, 0x02, 0x8E, 0x0A, 0x80,
+  0x02, 0x92, 0x0A, 0x96, 0x09, 0x94, 0x0C, 0x90, 0x02, 0x81, 0x1B, 0x83, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x1A, 0x83, 0x0B, 0x8E, 0x01, 0x81, 0x0B, 0x90,
+  0x0D, 0x92, 0x0D, 0x90, 0x0F, 0x8E, 0x28,
+  // 0x36 '6', offset 698
+  0x27, 0x8E, 0x0F, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x0B, 0x81, 0x01, 0x8E, 0x0B, 0x83, 0x1A, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x84, 0x1A, 0x82, 0x02, 0x8E, 0x0A, 0x80,
+  0x02, 0x92, 0x0A, 0x96, 0x06, 0x80, 0x01, 0x94, 0x07, 0x82, 0x01, 0x90, 0x02, 0x81, 0x04, 0x84,
+  0x11, 0x83, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85,
+  0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85,
+  0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85,
+  0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x05, 0x83, 0x10, 0x83, 0x07, 0x81,
+  0x01, 0x8E, 0x01, 0x81, 0x0B, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x0F, 0x8E, 0x28,
+  // 0x37 '7', offset 839
+  0x27, 0x8E, 0x0F, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x01, 0x80, 0x0C, 0x8E, 0x01, 0x82, 0x1B, 0x84,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x1A, 0x84, 0x1C, 0x82, 0x1E, 0x80,
+  0x5D, 0x81, 0x1B, 0x83, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x1A, 0x83, 0x1C, 0x81, 0x7F, 0x24,
+  // 0x38 '8', offset 925
+  0x27, 0x8E, 0x0F, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x01, 0x80, 0x08, 0x81, 0x01, 0x8E, 0x01, 0x82,
+  0x06, 0x83, 0x10, 0x84, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x84, 0x10, 0x84, 0x04, 0x82, 0x02, 0x8E,
+  0x02, 0x82, 0x04, 0x80, 0x02, 0x92, 0x02, 0x80, 0x06, 0x96, 0x06, 0x80, 0x01, 0x94, 0x07, 0x82,
+  0x01, 0x90, 0x02, 0x81, 0x04, 0x84, 0x11, 0x83, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x05, 0x83, 0x10, 0x83, 0x07, 0x81, 0x01, 0x8E, 0x01, 0x81, 0x0B, 0x90, 0x0D, 0x92, 0x0D, 0x90,
+  0x0F, 0x8E, 0x28,
+  // 0x39 '9', offset 1104
+  0x27, 0x8E, 0x0F, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x01, 0x80, 0x08, 0x81, 0x01, 0x8E, 0x01, 0x82,
+  0x06, 0x83, 0x10, 0x84, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85,
+  0x04, 0x85, 0x0E, 0x85, 0x04, 0x85, 0x0E, 0x85, 0x04, 0x84, 0x10, 0x84, 0x04, 0x82, 0x02, 0x8E,
+  0x02, 0x82, 0x04, 0x80, 0x02, 0x92, 0x02, 0x80, 0x06, 0x96, 0x09, 0x94, 0x0C, 0x90, 0x02, 0x81,
+  0x1B, 0x83, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85,
+  0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x19, 0x85, 0x1A, 0x83,
+  0x0B, 0x8E, 0x01, 0x81, 0x0B, 0x90, 0x0D, 0x92, 0x0D, 0x90, 0x0F, 0x8E, 0x28,
+  // 0x3A ':', offset 1245
+  0x7F, 0x1F, 0x82, 0x07, 0x84, 0x06, 0x84, 0x06, 0x84, 0x07, 0x82, 0x7F, 0x18, 0x82, 0x07, 0x84,
+  0x06, 0x84, 0x06, 0x84, 0x07, 0x82, 0x7F, 0x20
 };
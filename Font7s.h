@@ -1,7 +1,10 @@
+#include <stdint.h>
+
 #define nr_chrs_f7s 96
 #define chr_hgt_f7s 48
 #define data_size_f7s 8
 #define firstchr_f7s 32
+#define enc_f7s 1		// glyph encoding, SSD1322_FONT_RLE
 
-extern const unsigned char widtbl_f7s[96];
-extern const unsigned char* const chrtbl_f7s[96];
+extern const uint32_t idxtbl_f7s[96];            // offset | width << 16, or SSD1322_GLYPH_BLANK
+extern const unsigned char chrdat_f7s[];
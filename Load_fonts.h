@@ -1,8 +1,8 @@
 // Comment out the #defines below with // to stop that font being loaded
-// If all fonts are loaded the total space required is ablout 17890 bytes
+// If all fonts are loaded the total space required is ablout 13400 bytes
 
 #define LOAD_GLCD // Standard Adafruit font needs ~1792 bytes in FLASH
 #define LOAD_FONT2 // Small font, needs ~3092 bytes in FLASH
-//#define LOAD_FONT4 // Medium font, needs ~8126 bytes in FLASH
-//#define LOAD_FONT6 // Large font, needs ~4404 bytes in FLASH
-//#define LOAD_FONT7 // 7 segment font, needs ~3652 bytes in FLASH
+//#define LOAD_FONT4 // Medium font, needs ~4983 bytes in FLASH
+//#define LOAD_FONT6 // Large font, needs ~1873 bytes in FLASH
+//#define LOAD_FONT7 // 7 segment font, needs ~1653 bytes in FLASH
@@ -0,0 +1,195 @@
+/**
+ * A number field for the SSD1322 frame buffer, see SSD1322_NumberField.h.
+ */
+#include "SSD1322_NumberField.h"
+
+/**
+ * @param size - the font, as in drawString(); 0 is the GLCD font.
+ * @param width - characters the numbers of setInt(), setFixed() and
+ * setFloat() are padded to with pad (' ' or '0'), so the field keeps its
+ * cells when the value gets shorter.
+ * @param bg - the colour cells are cleared to; it must differ from color.
+ * @param scale - the text size.
+ */
+SSD1322_NumberField::SSD1322_NumberField(ESP8266_SSD1322 &display, int16_t x, int16_t y, uint8_t size,
+                                         uint8_t width, uint16_t color, uint16_t bg, char pad, uint8_t scale) :
+    disp(display), x(x), y(y), size(size), width(width), scale(scale ? scale : 1),
+    color(color), bg(bg), pad(pad) {
+  drawn = false;
+  count = 0;
+  cellX[0] = x;
+  dirty = 0;
+  tailX0 = tailX1 = x;
+}
+
+int16_t SSD1322_NumberField::height(void)
+{
+  const SSD1322_Font *font = ESP8266_SSD1322::getFont(size);
+  return (size ? (font ? font->height : 0) : 8) * scale;
+}
+
+/**
+ * Show UTF-8 text, up to SSD1322_NUMBER_WIDTH characters.  Cells keeping their
+ * character and place are left alone; from the first cell that moves on,
+ * every cell is drawn again, and the buffer the text no longer covers is
+ * cleared.
+ * @return the screen area that changed.
+ */
+SSD1322_Rect SSD1322_NumberField::setText(const char *text)
+{
+  int16_t x0 = 0, x1 = 0;	// what changed, x0 == x1 when nothing
+  int16_t h = height();
+  char c[5];	// one character's bytes
+  uint8_t i;
+
+  uint8_t oldScale = disp.getTextSize();
+  uint16_t oldColor = disp.getTextColor(), oldBg = disp.getTextBgColor();
+  disp.setTextSize(scale);
+  disp.setTextColor(color, bg);
+
+  // where the old text ends, before its cells are overwritten
+  int16_t end = drawn ? cellX[count] : x;
+  int16_t cx = x;
+  for (i = 0; *text && i < SSD1322_NUMBER_WIDTH; i++)
+  {
+    const char *from = text;
+    uint16_t code = ESP8266_SSD1322::decodeUtf8(text);
+    memcpy(c, from, text - from);
+    c[text - from] = 0;
+    int16_t w = disp.measureString(c, size);
+
+    if (!drawn || i >= count || code != shown[i] || cx != cellX[i] || cx + w != cellX[i + 1])
+    {
+      // opaque, so the glyph clears its own cell
+      disp.drawString(c, cx, y, size);
+      shown[i] = code;
+      dirty |= 1UL << i;
+      if (x0 == x1)
+      {
+        x0 = cx;
+      }
+      x1 = cx + w;
+    }
+    cellX[i] = cx;
+    cx += w;
+  }
+
+  // cells that are gone
+  if (end > cx)
+  {
+    disp.fillRect(cx, y, end - cx, h, bg);
+    if (x0 == x1)
+    {
+      x0 = cx;
+    }
+    x1 = end;
+    if (tailX0 == tailX1)
+    {
+      tailX0 = cx;
+      tailX1 = end;
+    }
+    else
+    {
+      tailX0 = min(tailX0, cx);
+      tailX1 = max(tailX1, end);
+    }
+  }
+
+  dirty &= (1UL << i) - 1;
+  count = i;
+  cellX[count] = cx;
+  drawn = true;
+
+  disp.setTextSize(oldScale);
+  disp.setTextColor(oldColor, oldBg);
+  return clip(x0, x1);
+}
+
+SSD1322_Rect SSD1322_NumberField::setInt(long value)
+{
+  char tmp[SSD1322_NUMBER_WIDTH + 1];
+  return setText(ESP8266_SSD1322::formatFixed(tmp, value, 0, width, pad));
+}
+
+// value / 10^decimals, as drawFixed()
+SSD1322_Rect SSD1322_NumberField::setFixed(long value, uint8_t decimals)
+{
+  char tmp[SSD1322_NUMBER_WIDTH + 1];
+  return setText(ESP8266_SSD1322::formatFixed(tmp, value, decimals, width, pad));
+}
+
+SSD1322_Rect SSD1322_NumberField::setFloat(float value, uint8_t decimals)
+{
+  char tmp[SSD1322_NUMBER_WIDTH + 1];
+  return setText(ESP8266_SSD1322::formatFloat(tmp, value, decimals, width, pad));
+}
+
+/**
+ * Draw every cell at the next set*(), after the buffer under the field was
+ * drawn over or cleared.
+ */
+void SSD1322_NumberField::invalidate(void)
+{
+  drawn = false;
+}
+
+/**
+ * Send the cells changed since the last flush() to the panel, each run of
+ * neighbouring cells with one displayRect().
+ */
+void SSD1322_NumberField::flush(void)
+{
+  uint8_t i = 0;
+
+  while (i < count)
+  {
+    if (!(dirty & (1UL << i)))
+    {
+      i++;
+      continue;
+    }
+
+    uint8_t j = i;
+    while (j < count && (dirty & (1UL << j)))
+    {
+      j++;
+    }
+    int16_t x0 = cellX[i], x1 = cellX[j];
+
+    // a cleared tail touching the run goes with it
+    if (tailX0 < tailX1 && tailX0 <= x1 && tailX1 >= x0)
+    {
+      x0 = min(x0, tailX0);
+      x1 = max(x1, tailX1);
+      tailX0 = tailX1;
+    }
+    disp.displayRect(clip(x0, x1));
+    i = j;
+  }
+
+  if (tailX0 < tailX1)
+  {
+    disp.displayRect(clip(tailX0, tailX1));
+  }
+  dirty = 0;
+  tailX0 = tailX1 = x;
+}
+
+// Columns x0 .. x1 - 1 of the field, on screen
+SSD1322_Rect SSD1322_NumberField::clip(int16_t x0, int16_t x1)
+{
+  SSD1322_Rect r = { 0, 0, 0, 0 };
+  int16_t y0 = max(y, (int16_t)0);
+  int16_t y1 = min((int16_t)(y + height()), disp.height());
+
+  x0 = max(x0, (int16_t)0);
+  x1 = min(x1, disp.width());
+  if (x0 < x1 && y0 < y1)
+  {
+    r.x = x0;
+    r.y = y0;
+    r.w = x1 - x0;
+    r.h = y1 - y0;
+  }
+  return r;
+}
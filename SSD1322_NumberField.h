@@ -0,0 +1,53 @@
+/**
+ * A number field for the SSD1322 frame buffer: counters, clocks, readouts.
+ *
+ * The field sits at a fixed screen position in one font and remembers the
+ * text it drew.  A new value redraws only the character cells whose
+ * character or place changed, each cell cleared by drawing its glyph opaque,
+ * so a seconds counter in Font7s touches one or two digits a tick instead
+ * of the whole field.  Those cells are marked dirty for flush(), which sends
+ * them to the panel with displayRect(); set*() also return the area they
+ * changed.
+ *
+ * A cell is one character of UTF-8 text, as wide as its glyph's advance, so
+ * the font's glyphs must keep their ink within it, as the digits of the
+ * library's fonts do.  The display's text size and colours are put back
+ * after drawing.
+ */
+#ifndef _SSD1322_NUMBERFIELD_H
+#define _SSD1322_NUMBERFIELD_H
+
+#include "ESP8266_SSD1322.h"
+
+class SSD1322_NumberField {
+ public:
+  SSD1322_NumberField(ESP8266_SSD1322 &display, int16_t x, int16_t y, uint8_t size, uint8_t width,
+                      uint16_t color, uint16_t bg, char pad = ' ', uint8_t scale = 1);
+
+  SSD1322_Rect setText(const char *text);
+  SSD1322_Rect setInt(long value);
+  SSD1322_Rect setFixed(long value, uint8_t decimals);
+  SSD1322_Rect setFloat(float value, uint8_t decimals);
+
+  void invalidate(void);
+  void flush(void);
+
+ private:
+  ESP8266_SSD1322 &disp;
+  int16_t x, y;
+  uint8_t size, width, scale;
+  uint16_t color, bg;
+  char pad;
+
+  boolean drawn;	// shown and cellX describe the buffer
+  uint8_t count;	// cells shown
+  uint16_t shown[SSD1322_NUMBER_WIDTH];	// code point of each cell
+  int16_t cellX[SSD1322_NUMBER_WIDTH + 1];	// left edge of each cell, then the end
+  uint32_t dirty;	// cells changed since flush(), bit i for cell i
+  int16_t tailX0, tailX1;	// cleared past the last cell since flush(), x0 == x1 when none
+
+  int16_t height(void);
+  SSD1322_Rect clip(int16_t x0, int16_t x1);
+};
+
+#endif
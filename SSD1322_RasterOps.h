@@ -0,0 +1,187 @@
+/**
+ * Raster-op kernels for the SSD1322 frame buffer.
+ *
+ * Each kernel combines a destination byte with a source byte under a mask.
+ * The op is a template parameter, so a primitive picks its kernel once and
+ * then runs a branch free inner loop.  A byte holds 8 pixels (1 bit per pixel,
+ * MSB left) or 2 pixels (4 bits per pixel, high nibble left); the nibble wise
+ * ops (MAX, MIN, ADDS) only differ from OR/AND in 4 bit mode.
+ *
+ * Internal header, include after ESP8266_SSD1322.h.
+ */
+#ifndef _SSD1322_RASTEROPS_H
+#define _SSD1322_RASTEROPS_H
+
+#ifdef SSD1322_256_64_4
+static inline uint8_t nibbleMax(uint8_t a, uint8_t b)
+{
+  return (((a & 0xF0) > (b & 0xF0)) ? (a & 0xF0) : (b & 0xF0)) |
+         (((a & 0x0F) > (b & 0x0F)) ? (a & 0x0F) : (b & 0x0F));
+}
+
+static inline uint8_t nibbleMin(uint8_t a, uint8_t b)
+{
+  return (((a & 0xF0) < (b & 0xF0)) ? (a & 0xF0) : (b & 0xF0)) |
+         (((a & 0x0F) < (b & 0x0F)) ? (a & 0x0F) : (b & 0x0F));
+}
+
+static inline uint8_t nibbleAddSat(uint8_t a, uint8_t b)
+{
+  uint8_t hi = (a >> 4) + (b >> 4);
+  uint8_t lo = (a & 0x0F) + (b & 0x0F);
+  if (hi > 0x0F) hi = 0x0F;
+  if (lo > 0x0F) lo = 0x0F;
+  return (hi << 4) | lo;
+}
+#endif
+
+// Combine one byte. Only the bits set in mask may change.
+template <uint8_t OP>
+static inline uint8_t ropByte(uint8_t dst, uint8_t src, uint8_t mask)
+{
+  switch (OP)
+  {
+    case SSD1322_ROP_SET:   return dst | mask;
+    case SSD1322_ROP_CLEAR: return dst & ~mask;
+    case SSD1322_ROP_XOR:   return dst ^ (src & mask);
+    case SSD1322_ROP_AND:   return dst & (src | ~mask);
+#ifdef SSD1322_256_64_4
+    case SSD1322_ROP_OR:    return dst | (src & mask);
+    case SSD1322_ROP_MAX:   return (dst & ~mask) | (nibbleMax(dst, src) & mask);
+    case SSD1322_ROP_MIN:   return (dst & ~mask) | (nibbleMin(dst, src) & mask);
+    case SSD1322_ROP_ADDS:  return (dst & ~mask) | (nibbleAddSat(dst, src) & mask);
+#else
+    // with one bit per pixel max and saturating add are OR, min is AND
+    case SSD1322_ROP_OR:
+    case SSD1322_ROP_MAX:
+    case SSD1322_ROP_ADDS:  return dst | (src & mask);
+    case SSD1322_ROP_MIN:   return dst & (src | ~mask);
+#endif
+    default:                return (dst & ~mask) | (src & mask); // SSD1322_ROP_COPY
+  }
+}
+
+// Run time selection for single pixel writes, where a table call costs more than the switch.
+static inline uint8_t ropApply(uint8_t op, uint8_t dst, uint8_t src, uint8_t mask)
+{
+  switch (op)
+  {
+    case SSD1322_ROP_SET:   return ropByte<SSD1322_ROP_SET>(dst, src, mask);
+    case SSD1322_ROP_CLEAR: return ropByte<SSD1322_ROP_CLEAR>(dst, src, mask);
+    case SSD1322_ROP_XOR:   return ropByte<SSD1322_ROP_XOR>(dst, src, mask);
+    case SSD1322_ROP_AND:   return ropByte<SSD1322_ROP_AND>(dst, src, mask);
+    case SSD1322_ROP_OR:    return ropByte<SSD1322_ROP_OR>(dst, src, mask);
+    case SSD1322_ROP_MAX:   return ropByte<SSD1322_ROP_MAX>(dst, src, mask);
+    case SSD1322_ROP_MIN:   return ropByte<SSD1322_ROP_MIN>(dst, src, mask);
+    case SSD1322_ROP_ADDS:  return ropByte<SSD1322_ROP_ADDS>(dst, src, mask);
+    default:                return ropByte<SSD1322_ROP_COPY>(dst, src, mask);
+  }
+}
+
+// One buffer row: an optional leading partial byte, n whole bytes and an optional trailing partial byte.
+template <uint8_t OP>
+static void ropSpan(uint8_t *pBuf, uint8_t src, uint8_t firstMask, uint16_t n, uint8_t lastMask)
+{
+  if (firstMask)
+  {
+    *pBuf = ropByte<OP>(*pBuf, src, firstMask);
+    pBuf++;
+  }
+
+  if (OP == SSD1322_ROP_COPY || OP == SSD1322_ROP_SET || OP == SSD1322_ROP_CLEAR)
+  {
+    memset(pBuf, ropByte<OP>(0, src, 0xFF), n);
+    pBuf += n;
+  }
+  else
+  {
+    while (n--)
+    {
+      *pBuf = ropByte<OP>(*pBuf, src, 0xFF);
+      pBuf++;
+    }
+  }
+
+  if (lastMask)
+  {
+    *pBuf = ropByte<OP>(*pBuf, src, lastMask);
+  }
+}
+
+// The same mask down h rows, stride bytes apart.
+template <uint8_t OP>
+static void ropColumn(uint8_t *pBuf, uint8_t src, uint8_t mask, uint16_t h, uint16_t stride)
+{
+  while (h--)
+  {
+    *pBuf = ropByte<OP>(*pBuf, src, mask);
+    pBuf += stride;
+  }
+}
+
+// Masks of the leftmost and rightmost pixel of a byte
+#define SSD1322_LEFT_PIXEL ((uint8_t)(0xFF << (8 - SSD1322_BITS_PER_PIXEL)))
+#define SSD1322_RIGHT_PIXEL ((uint8_t)((1 << SSD1322_BITS_PER_PIXEL) - 1))
+
+// A line steeper than 45 degrees, one pixel per row (Bresenham).  The pixel
+// mask moves sideways, and the pointer with it, whenever the error runs out.
+template <uint8_t OP>
+static void ropLineSteep(uint8_t *pBuf, uint8_t mask, uint8_t src, uint16_t n, uint16_t stride,
+                         int16_t err, int16_t dMajor, int16_t dMinor, int8_t step)
+{
+  while (n--)
+  {
+    *pBuf = ropByte<OP>(*pBuf, src, mask);
+    pBuf += stride;
+    err -= dMinor;
+    if (err < 0)
+    {
+      err += dMajor;
+      if (step > 0)
+      {
+        mask >>= SSD1322_BITS_PER_PIXEL;
+        if (!mask)
+        {
+          mask = SSD1322_LEFT_PIXEL;
+          pBuf++;
+        }
+      }
+      else
+      {
+        mask <<= SSD1322_BITS_PER_PIXEL;
+        if (!mask)
+        {
+          mask = SSD1322_RIGHT_PIXEL;
+          pBuf--;
+        }
+      }
+    }
+  }
+}
+
+// Transpose an 8x8 bit matrix, rows MSB left: out[c] bit (7 - r) = in[r] bit (7 - c).
+// in and out may be the same array.
+static inline void transpose8(const uint8_t *in, uint8_t *out)
+{
+  register uint32_t x = ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) | ((uint32_t)in[2] << 8) | in[3];
+  register uint32_t y = ((uint32_t)in[4] << 24) | ((uint32_t)in[5] << 16) | ((uint32_t)in[6] << 8) | in[7];
+  register uint32_t t;
+
+  t = (x ^ (x >> 7)) & 0x00AA00AA;  x = x ^ t ^ (t << 7);
+  t = (y ^ (y >> 7)) & 0x00AA00AA;  y = y ^ t ^ (t << 7);
+  t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+  t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+  t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+  y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+  x = t;
+
+  out[0] = x >> 24; out[1] = x >> 16; out[2] = x >> 8; out[3] = x;
+  out[4] = y >> 24; out[5] = y >> 16; out[6] = y >> 8; out[7] = y;
+}
+
+typedef void (*RopSpanFn)(uint8_t *pBuf, uint8_t src, uint8_t firstMask, uint16_t n, uint8_t lastMask);
+typedef void (*RopColumnFn)(uint8_t *pBuf, uint8_t src, uint8_t mask, uint16_t h, uint16_t stride);
+typedef void (*RopLineFn)(uint8_t *pBuf, uint8_t mask, uint8_t src, uint16_t n, uint16_t stride,
+                          int16_t err, int16_t dMajor, int16_t dMinor, int8_t step);
+
+#endif
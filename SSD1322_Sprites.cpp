@@ -0,0 +1,310 @@
+/**
+ * Sprites for the SSD1322 frame buffer, see SSD1322_Sprites.h.
+ */
+#include "SSD1322_Sprites.h"
+
+// Grow a to cover b too
+static void unite(SSD1322_Rect &a, const SSD1322_Rect &b)
+{
+  if (b.w <= 0 || b.h <= 0)
+  {
+    return;
+  }
+  if (a.w <= 0 || a.h <= 0)
+  {
+    a = b;
+    return;
+  }
+
+  int16_t x1 = max(a.x + a.w, b.x + b.w);
+  int16_t y1 = max(a.y + a.h, b.y + b.h);
+  a.x = min(a.x, b.x);
+  a.y = min(a.y, b.y);
+  a.w = x1 - a.x;
+  a.h = y1 - a.y;
+}
+
+SSD1322_Sprites::SSD1322_Sprites(ESP8266_SSD1322 &display) :
+    disp(display) {
+  count = 0;
+  for (uint8_t i = 0; i < SSD1322_MAX_SPRITES; i++)
+  {
+    sprites[i].used = false;
+  }
+  stacked = 0;
+}
+
+boolean SSD1322_Sprites::valid(int8_t id)
+{
+  return (id >= 0) && (id < SSD1322_MAX_SPRITES) && sprites[id].used && !sprites[id].dropped;
+}
+
+/**
+ * Add a sprite, hidden until the first moveTo().
+ * @param bitmap - a 1 bit mask drawn in color (SSD1322_BLIT_MASKED), or
+ * with SSD1322_BLIT_OPAQUE a bitmap in the buffer format: in 4 bit mode
+ * color is then the gray level to leave out, or SSD1322_TRANSPARENT.
+ * Add SSD1322_BLIT_RAM for a bitmap in RAM.
+ * @param z - higher z is drawn on top; equal z keeps the order of adding.
+ * @return the sprite id, or -1 if the pool is full or the sprite is larger
+ * than SSD1322_SPRITE_MAX_SIZE.
+ */
+int8_t SSD1322_Sprites::add(const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color,
+                            uint8_t flags, uint8_t z)
+{
+  if (w <= 0 || h <= 0 || w > SSD1322_SPRITE_MAX_SIZE || h > SSD1322_SPRITE_MAX_SIZE)
+  {
+    return -1;
+  }
+
+  for (uint8_t id = 0; id < SSD1322_MAX_SPRITES; id++)
+  {
+    Sprite &s = sprites[id];
+    if (s.used)
+    {
+      continue;
+    }
+
+    s.bitmap = bitmap;
+    s.x = s.y = 0;
+    s.w = w;
+    s.h = h;
+    s.color = color;
+    s.flags = flags;
+    s.z = z;
+    s.used = true;
+    s.dropped = false;
+    s.visible = false;
+    s.changed = false;
+    s.drawn.w = 0;
+
+    added[count++] = id;
+    sort();
+    return id;
+  }
+  return -1;
+}
+
+/**
+ * Take a sprite out of the pool.  Its background comes back with the next
+ * update(), its slot is free from then on (right away if it is not drawn).
+ */
+void SSD1322_Sprites::remove(int8_t id)
+{
+  if (!valid(id))
+  {
+    return;
+  }
+
+  // kept until update() has put its background back
+  sprites[id].visible = false;
+  sprites[id].changed = true;
+  sprites[id].dropped = true;
+  release();
+}
+
+void SSD1322_Sprites::moveTo(int8_t id, int16_t x, int16_t y)
+{
+  if (!valid(id))
+  {
+    return;
+  }
+
+  Sprite &s = sprites[id];
+  if (s.x != x || s.y != y || !s.visible)
+  {
+    s.x = x;
+    s.y = y;
+    s.visible = true;
+    s.changed = true;
+  }
+}
+
+// Show another frame of the same size
+void SSD1322_Sprites::setBitmap(int8_t id, const uint8_t *bitmap)
+{
+  if (!valid(id) || sprites[id].bitmap == bitmap)
+  {
+    return;
+  }
+  sprites[id].bitmap = bitmap;
+  sprites[id].changed = true;
+}
+
+void SSD1322_Sprites::setVisible(int8_t id, boolean visible)
+{
+  if (!valid(id) || sprites[id].visible == visible)
+  {
+    return;
+  }
+  sprites[id].visible = visible;
+  sprites[id].changed = true;
+}
+
+void SSD1322_Sprites::setZ(int8_t id, uint8_t z)
+{
+  if (!valid(id) || sprites[id].z == z)
+  {
+    return;
+  }
+  sprites[id].z = z;
+  sprites[id].changed = true;
+  sort();
+}
+
+// order[] holds the used sprites by z, in the order they were added for equal z
+void SSD1322_Sprites::sort(void)
+{
+  uint8_t n = 0;
+  for (uint8_t i = 0; i < count; i++)
+  {
+    if (sprites[added[i]].used)
+    {
+      added[n++] = added[i];
+    }
+  }
+  count = n;
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    uint8_t id = added[i];
+    uint8_t j = i;
+    for (; j > 0 && sprites[order[j - 1]].z > sprites[id].z; j--)
+    {
+      order[j] = order[j - 1];
+    }
+    order[j] = id;
+  }
+}
+
+void SSD1322_Sprites::draw(Sprite &s)
+{
+#ifdef SSD1322_256_64_4
+  if (s.flags & SSD1322_BLIT_OPAQUE)
+    disp.drawBitmap4(s.x, s.y, s.bitmap, s.w, s.h, s.color, NULL, s.flags & SSD1322_BLIT_RAM);
+  else
+    disp.drawMonoBitmap4(s.x, s.y, s.bitmap, s.w, s.h, s.color, SSD1322_TRANSPARENT, s.flags & SSD1322_BLIT_RAM);
+#else
+  disp.blit(s.x, s.y, s.bitmap, s.w, s.h, s.color, s.flags);
+#endif
+}
+
+/**
+ * Bring the buffer up to date with the sprites.
+ * @return the screen area that changed, w = 0 if nothing did.
+ */
+SSD1322_Rect SSD1322_Sprites::update(void)
+{
+  SSD1322_Rect dirty = { 0, 0, 0, 0 };
+  boolean changed = false;
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    Sprite &s = sprites[order[i]];
+    changed |= s.changed || (s.visible && s.drawn.w == 0);
+  }
+  if (!changed)
+  {
+    return dirty;
+  }
+
+  // backgrounds back, top first, so each restore sees what it saved
+  unstack(dirty, false);
+
+  // then save and draw, bottom first
+  for (uint8_t i = 0; i < count; i++)
+  {
+    uint8_t id = order[i];
+    Sprite &s = sprites[id];
+
+    if (s.visible)
+    {
+      SSD1322_Rect r = { s.x, s.y, s.w, s.h };
+      disp.saveRect(r, saved[id]);
+      draw(s);
+      s.drawn = r;
+      stack[stacked++] = id;
+      if (s.changed)
+      {
+        unite(dirty, r);
+      }
+    }
+    s.changed = false;
+  }
+
+  release();
+  return clip(dirty);
+}
+
+/**
+ * Put every background back and leave the sprites off the buffer, to draw
+ * underneath them.  The next update() draws them again.
+ * @return the screen area that changed.
+ */
+SSD1322_Rect SSD1322_Sprites::hide(void)
+{
+  SSD1322_Rect dirty = { 0, 0, 0, 0 };
+
+  unstack(dirty, true);
+  release();
+  return clip(dirty);
+}
+
+// Restore the drawn sprites in the reverse order of drawing.  z may have
+// changed since, so order[] will not do.
+void SSD1322_Sprites::unstack(SSD1322_Rect &dirty, boolean all)
+{
+  while (stacked)
+  {
+    uint8_t id = stack[--stacked];
+    Sprite &s = sprites[id];
+
+    disp.restoreRect(s.drawn, saved[id]);
+    if (all || s.changed)
+    {
+      unite(dirty, s.drawn);
+    }
+    if (all)
+    {
+      // draw it again next update()
+      s.changed = true;
+    }
+    s.drawn.w = 0;
+  }
+}
+
+// Free the removed sprites whose backgrounds are back
+void SSD1322_Sprites::release(void)
+{
+  boolean freed = false;
+
+  for (uint8_t i = 0; i < count; i++)
+  {
+    Sprite &s = sprites[order[i]];
+    if (s.dropped && s.drawn.w == 0)
+    {
+      s.used = false;
+      freed = true;
+    }
+  }
+  if (freed)
+  {
+    sort();
+  }
+}
+
+SSD1322_Rect SSD1322_Sprites::clip(SSD1322_Rect r)
+{
+  int16_t x1 = min((int16_t)(r.x + r.w), disp.width());
+  int16_t y1 = min((int16_t)(r.y + r.h), disp.height());
+
+  r.x = max(r.x, (int16_t)0);
+  r.y = max(r.y, (int16_t)0);
+  r.w = max((int16_t)(x1 - r.x), (int16_t)0);
+  r.h = max((int16_t)(y1 - r.y), (int16_t)0);
+  if (r.w == 0 || r.h == 0)
+  {
+    r.w = r.h = 0;
+  }
+  return r;
+}
@@ -0,0 +1,68 @@
+/**
+ * Sprites for the SSD1322 frame buffer.
+ *
+ * Each visible sprite keeps a copy of the buffer under it.  update() puts
+ * those backgrounds back, top sprite first, then saves and draws every
+ * sprite again bottom up, so moving sprites never wipe what is under them.
+ * It returns the area that changed, ready for displayRect().  Everything
+ * lives in a fixed pool sized below, there is no heap use.
+ *
+ * Draw on the background only between hide() and the next update().
+ */
+#ifndef _SSD1322_SPRITES_H
+#define _SSD1322_SPRITES_H
+
+#include "ESP8266_SSD1322.h"
+
+#define SSD1322_MAX_SPRITES 8
+#define SSD1322_SPRITE_MAX_SIZE 32	// largest sprite width or height in pixels
+
+// save-under room per sprite, see ESP8266_SSD1322::saveSize()
+#define SSD1322_SPRITE_SAVE_BYTES \
+  ((((SSD1322_SPRITE_MAX_SIZE * SSD1322_BITS_PER_PIXEL + 7) / 8) + 1) * SSD1322_SPRITE_MAX_SIZE)
+
+class SSD1322_Sprites {
+ public:
+  SSD1322_Sprites(ESP8266_SSD1322 &display);
+
+  int8_t add(const uint8_t *bitmap, int16_t w, int16_t h, uint16_t color,
+             uint8_t flags = SSD1322_BLIT_MASKED, uint8_t z = 0);
+  void remove(int8_t id);
+
+  void moveTo(int8_t id, int16_t x, int16_t y);
+  void setBitmap(int8_t id, const uint8_t *bitmap);
+  void setVisible(int8_t id, boolean visible);
+  void setZ(int8_t id, uint8_t z);
+
+  SSD1322_Rect update(void);
+  SSD1322_Rect hide(void);
+
+ private:
+  typedef struct {
+    const uint8_t *bitmap;
+    int16_t x, y, w, h;
+    uint16_t color;
+    uint8_t flags;
+    uint8_t z;
+    boolean used, dropped, visible, changed;
+    SSD1322_Rect drawn;	// where it is in the buffer now, w = 0 when it is not
+  } Sprite;
+
+  ESP8266_SSD1322 &disp;
+  Sprite sprites[SSD1322_MAX_SPRITES];
+  uint8_t added[SSD1322_MAX_SPRITES];	// used sprites, oldest first
+  uint8_t order[SSD1322_MAX_SPRITES];	// the same by z, lowest first
+  uint8_t count;
+  uint8_t stack[SSD1322_MAX_SPRITES];	// drawn sprites, bottom first
+  uint8_t stacked;
+  uint8_t saved[SSD1322_MAX_SPRITES][SSD1322_SPRITE_SAVE_BYTES];
+
+  boolean valid(int8_t id);
+  void sort(void);
+  void draw(Sprite &s);
+  void unstack(SSD1322_Rect &dirty, boolean all);
+  void release(void);
+  SSD1322_Rect clip(SSD1322_Rect r);
+};
+
+#endif
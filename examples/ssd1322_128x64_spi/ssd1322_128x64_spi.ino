@@ -39,6 +39,7 @@ All text above, and the splash screen must be included in any redistribution
 #include <SPI.h>
 #include <Adafruit_GFX.h>
 #include <ESP8266_SSD1322.h>
+#include <SSD1322_Sprites.h>
 
 //ESP8266 Pins
 //#define OLED_CS     15  // Pin 19, CS - Chip select
@@ -57,8 +58,9 @@ All text above, and the splash screen must be included in any redistribution
 
 //hardware SPI - only way to go. Can get 110 FPS
 ESP8266_SSD1322 display(OLED_DC, OLED_RESET, OLED_CS);
+SSD1322_Sprites sprites(display);
 
-#define NUMFLAKES 10
+#define NUMFLAKES SSD1322_MAX_SPRITES
 #define XPOS 0
 #define YPOS 1
 #define DELTAY 2
@@ -220,18 +222,22 @@ void testdrawbitmap(const uint8_t *bitmap, uint8_t w, uint8_t h) {
     Serial.println(icons[f][DELTAY], DEC);
   }
 
+  // each icon is a sprite, it puts back what was under it when it moves
+  int8_t ids[NUMFLAKES];
+  for (uint8_t f=0; f< NUMFLAKES; f++) {
+    ids[f] = sprites.add(bitmap, w, h, WHITE);
+  }
+
   while (1) {
-    // draw each icon
     for (uint8_t f=0; f< NUMFLAKES; f++) {
-      display.drawBitmap(icons[f][XPOS], icons[f][YPOS], logo16_glcd_bmp, w, h, WHITE);
+      sprites.moveTo(ids[f], icons[f][XPOS], icons[f][YPOS]);
     }
-    display.display();
+    // send only the part of the screen that changed
+    display.displayRect(sprites.update());
     delay(200);
     
-    // then erase it + move it
+    // move them
     for (uint8_t f=0; f< NUMFLAKES; f++) {
-      display.drawBitmap(icons[f][XPOS], icons[f][YPOS],  logo16_glcd_bmp, w, h, BLACK);
-      // move it
       icons[f][YPOS] += icons[f][DELTAY];
       // if its gone, reinit
       if (icons[f][YPOS] > display.height()) {
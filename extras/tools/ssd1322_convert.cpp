@@ -0,0 +1,834 @@
+/**
+ * Convert images into PROGMEM bitmaps for the ESP8266_SSD1322 library.
+ * Runs on the host, not on the board.
+ *
+ * Build:  g++ -O2 -o ssd1322_convert ssd1322_convert.cpp
+ * Use:    ssd1322_convert [options] image... > images.h
+ *
+ *   -4           4 bit gray levels for SSD1322_256_64_4 (default)
+ *   -1           1 bit pixels for SSD1322_256_64_1
+ *   -d none      round to the nearest level (default), 1 bit: -t threshold
+ *   -d ordered   8x8 Bayer ordered dither
+ *   -d fs        Floyd-Steinberg error diffusion
+ *   -t level     1 bit threshold without dithering, 0..255 (default 128)
+ *   -i           invert
+ *   -a           pad the width to a multiple of 4 pixels, the controller's
+ *                column unit, so displayRLEBitmap() and byte aligned copies
+ *                can take it
+ *   -r           run length encode for drawRLEBitmap() / displayRLEBitmap()
+ *   -n name      array name, for a single image (default: the file name)
+ *
+ * Reads PGM/PBM (binary P5/P4), BMP (uncompressed 1, 4, 8, 24 and 32 bit)
+ * and PNG (any colour type, not interlaced).  Colour is turned to gray,
+ * alpha is laid over black.
+ *
+ * Raw bitmaps come out exactly as the buffer holds them: rows padded to a
+ * whole byte, MSB left in 1 bit mode, high nibble left in 4 bit mode, ready
+ * for blit(), fastDrawBitmap() and drawBitmap4().  Each array gets NAME_WIDTH
+ * and NAME_HEIGHT defines.  A report of the bytes per image goes to stderr.
+ *
+ * RLE layout: bits per pixel, width and height (16 bit little endian), then
+ * each row as PackBits: a control byte c below 128 is followed by c + 1
+ * literal bytes, above 128 by one byte repeated 257 - c times.  Runs never
+ * cross rows.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <ctype.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+typedef std::vector<uint8_t> Bytes;
+
+static bool readFile(const char *path, Bytes &data)
+{
+  FILE *f = fopen(path, "rb");
+  if (!f)
+    return false;
+
+  uint8_t chunk[4096];
+  size_t n;
+  while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0)
+    data.insert(data.end(), chunk, chunk + n);
+  fclose(f);
+  return true;
+}
+
+static uint32_t le16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+static uint32_t le32(const uint8_t *p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24); }
+static uint32_t be32(const uint8_t *p) { return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3]; }
+
+static uint8_t toGray(int r, int g, int b)
+{
+  return (uint8_t)((r * 77 + g * 150 + b * 29 + 128) >> 8);
+}
+
+/*
+ * PGM / PBM
+ */
+
+static bool pnmNumber(const Bytes &d, size_t &i, int &n)
+{
+  while (i < d.size() && (isspace(d[i]) || d[i] == '#'))
+  {
+    if (d[i] == '#')
+      while (i < d.size() && d[i] != '\n')
+        i++;
+    else
+      i++;
+  }
+  if (i >= d.size() || !isdigit(d[i]))
+    return false;
+
+  n = 0;
+  while (i < d.size() && isdigit(d[i]) && n < 1000000)
+    n = n * 10 + (d[i++] - '0');
+  return true;
+}
+
+static bool loadPnm(const Bytes &d, int &w, int &h, Bytes &gray)
+{
+  size_t i = 2;
+  int maxval = 1;
+  bool pbm = d[1] == '4';
+
+  if (!pnmNumber(d, i, w) || !pnmNumber(d, i, h) || (!pbm && !pnmNumber(d, i, maxval)))
+    return false;
+  if (w <= 0 || h <= 0 || maxval <= 0 || maxval > 65535)
+    return false;
+  i++; // the single white space before the pixels
+
+  gray.resize((size_t)w * h);
+  if (pbm)
+  {
+    // 1 bit, set is black
+    size_t stride = (w + 7) / 8;
+    if (d.size() < i + stride * h)
+      return false;
+    for (int y = 0; y < h; y++)
+      for (int x = 0; x < w; x++)
+        gray[(size_t)y * w + x] = (d[i + y * stride + (x >> 3)] & (0x80 >> (x & 7))) ? 0 : 255;
+    return true;
+  }
+
+  int bytes = (maxval > 255) ? 2 : 1;
+  if (d.size() < i + gray.size() * bytes)
+    return false;
+  for (size_t k = 0; k < gray.size(); k++)
+  {
+    int v = (bytes == 2) ? (d[i + 2 * k] << 8) | d[i + 2 * k + 1] : d[i + k];
+    gray[k] = (uint8_t)((v * 255 + maxval / 2) / maxval);
+  }
+  return true;
+}
+
+/*
+ * BMP, uncompressed
+ */
+
+static bool loadBmp(const Bytes &d, int &w, int &h, Bytes &gray)
+{
+  if (d.size() < 54)
+    return false;
+
+  uint32_t offset = le32(&d[10]);
+  uint32_t headerSize = le32(&d[14]);
+  int32_t width = (int32_t)le32(&d[18]);
+  int32_t height = (int32_t)le32(&d[22]);
+  int bits = le16(&d[28]);
+  uint32_t compression = le32(&d[30]);
+  uint32_t colours = le32(&d[46]);
+
+  // BI_RGB, or BI_BITFIELDS in the usual 32 bit BGRA order
+  if (compression != 0 && !(compression == 3 && bits == 32))
+    return false;
+  if (width <= 0 || height == 0 || height == INT32_MIN)
+    return false;
+  if (bits != 1 && bits != 4 && bits != 8 && bits != 24 && bits != 32)
+    return false;
+
+  bool bottomUp = height > 0;
+  w = width;
+  h = bottomUp ? height : -height;
+
+  // palette entries are BGR0, after the info header
+  uint8_t palette[256];
+  if (bits <= 8)
+  {
+    if (colours == 0 || colours > (1u << bits))
+      colours = 1u << bits;
+    size_t pal = 14 + headerSize;
+    if (d.size() < pal + colours * 4)
+      return false;
+    for (uint32_t c = 0; c < colours; c++)
+      palette[c] = toGray(d[pal + 4 * c + 2], d[pal + 4 * c + 1], d[pal + 4 * c]);
+    for (uint32_t c = colours; c < 256; c++)
+      palette[c] = 0;
+  }
+
+  size_t stride = (((size_t)w * bits + 31) / 32) * 4;
+  if (d.size() < offset + stride * h)
+    return false;
+
+  gray.resize((size_t)w * h);
+  for (int y = 0; y < h; y++)
+  {
+    const uint8_t *row = &d[offset + stride * (bottomUp ? h - 1 - y : y)];
+    for (int x = 0; x < w; x++)
+    {
+      uint8_t g;
+      switch (bits)
+      {
+        case 1:  g = palette[(row[x >> 3] >> (7 - (x & 7))) & 1]; break;
+        case 4:  g = palette[(row[x >> 1] >> ((x & 1) ? 0 : 4)) & 15]; break;
+        case 8:  g = palette[row[x]]; break;
+        case 24: g = toGray(row[3 * x + 2], row[3 * x + 1], row[3 * x]); break;
+        default: g = toGray(row[4 * x + 2], row[4 * x + 1], row[4 * x]); break;
+      }
+      gray[(size_t)y * w + x] = g;
+    }
+  }
+  return true;
+}
+
+/*
+ * PNG, with a small inflate (RFC 1951) after the canonical Huffman decoder
+ * of zlib's puff.c
+ */
+
+struct InflateState
+{
+  const uint8_t *in;
+  size_t inLen, pos;
+  uint32_t bitBuf;
+  int bitCnt;
+  Bytes *out;
+  bool error;
+};
+
+struct Huffman
+{
+  short count[16];	// codes of each length
+  short symbol[320];	// symbols ordered by code
+};
+
+static int bits(InflateState &s, int need)
+{
+  uint32_t val = s.bitBuf;
+  while (s.bitCnt < need)
+  {
+    if (s.pos >= s.inLen)
+    {
+      s.error = true;
+      return 0;
+    }
+    val |= (uint32_t)s.in[s.pos++] << s.bitCnt;
+    s.bitCnt += 8;
+  }
+  s.bitBuf = val >> need;
+  s.bitCnt -= need;
+  return val & ((1u << need) - 1);
+}
+
+static void buildHuffman(Huffman &h, const short *length, int n)
+{
+  short offs[16];
+
+  memset(h.count, 0, sizeof(h.count));
+  for (int i = 0; i < n; i++)
+    h.count[length[i]]++;
+
+  offs[1] = 0;
+  for (int len = 1; len < 15; len++)
+    offs[len + 1] = offs[len] + h.count[len];
+  for (int i = 0; i < n; i++)
+    if (length[i])
+      h.symbol[offs[length[i]]++] = i;
+}
+
+static int decodeSymbol(InflateState &s, const Huffman &h)
+{
+  int code = 0, first = 0, index = 0;
+
+  for (int len = 1; len < 16; len++)
+  {
+    code |= bits(s, 1);
+    int count = h.count[len];
+    if (code - count < first)
+      return h.symbol[index + (code - first)];
+    index += count;
+    first += count;
+    first <<= 1;
+    code <<= 1;
+    if (s.error)
+      break;
+  }
+  s.error = true;
+  return 0;
+}
+
+static void inflateCodes(InflateState &s, const Huffman &lencode, const Huffman &distcode)
+{
+  static const short lbase[29] = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+                                   35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+  static const short lext[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+                                  3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+  static const short dbase[30] = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+                                   257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+                                   8193, 12289, 16385, 24577 };
+  static const short dext[30] = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+                                  7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+  while (!s.error)
+  {
+    int sym = decodeSymbol(s, lencode);
+    if (sym < 256)
+    {
+      s.out->push_back((uint8_t)sym);
+      continue;
+    }
+    if (sym == 256)
+      return;
+
+    sym -= 257;
+    if (sym >= 29)
+      break;
+    int len = lbase[sym] + bits(s, lext[sym]);
+
+    int dsym = decodeSymbol(s, distcode);
+    if (dsym >= 30)
+      break;
+    size_t dist = dbase[dsym] + bits(s, dext[dsym]);
+    if (dist > s.out->size())
+      break;
+
+    size_t from = s.out->size() - dist;
+    for (int i = 0; i < len; i++)
+      s.out->push_back((*s.out)[from + i]);
+  }
+  s.error = true;
+}
+
+static void inflateDynamic(InflateState &s)
+{
+  static const short order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+  short lengths[320];
+  Huffman lencode, distcode;
+
+  int nlen = bits(s, 5) + 257;
+  int ndist = bits(s, 5) + 1;
+  int ncode = bits(s, 4) + 4;
+  if (nlen > 286 || ndist > 30)
+  {
+    s.error = true;
+    return;
+  }
+
+  memset(lengths, 0, sizeof(lengths));
+  for (int i = 0; i < ncode; i++)
+    lengths[order[i]] = bits(s, 3);
+  buildHuffman(lencode, lengths, 19);
+
+  int index = 0;
+  while (index < nlen + ndist && !s.error)
+  {
+    int sym = decodeSymbol(s, lencode);
+    if (sym < 16)
+    {
+      lengths[index++] = sym;
+      continue;
+    }
+
+    short len = 0;
+    int repeat;
+    if (sym == 16)
+    {
+      if (index == 0)
+      {
+        s.error = true;
+        return;
+      }
+      len = lengths[index - 1];
+      repeat = 3 + bits(s, 2);
+    }
+    else if (sym == 17)
+      repeat = 3 + bits(s, 3);
+    else
+      repeat = 11 + bits(s, 7);
+
+    if (index + repeat > nlen + ndist)
+    {
+      s.error = true;
+      return;
+    }
+    while (repeat--)
+      lengths[index++] = len;
+  }
+
+  buildHuffman(lencode, lengths, nlen);
+  buildHuffman(distcode, lengths + nlen, ndist);
+  inflateCodes(s, lencode, distcode);
+}
+
+static void inflateFixed(InflateState &s)
+{
+  static Huffman lencode, distcode;
+  static bool built = false;
+
+  if (!built)
+  {
+    short lengths[288];
+    int i = 0;
+    for (; i < 144; i++) lengths[i] = 8;
+    for (; i < 256; i++) lengths[i] = 9;
+    for (; i < 280; i++) lengths[i] = 7;
+    for (; i < 288; i++) lengths[i] = 8;
+    buildHuffman(lencode, lengths, 288);
+    for (i = 0; i < 30; i++) lengths[i] = 5;
+    buildHuffman(distcode, lengths, 30);
+    built = true;
+  }
+  inflateCodes(s, lencode, distcode);
+}
+
+static bool inflate(const uint8_t *in, size_t len, Bytes &out)
+{
+  InflateState s = { in, len, 0, 0, 0, &out, false };
+  int last;
+
+  do
+  {
+    last = bits(s, 1);
+    int type = bits(s, 2);
+    if (type == 0)
+    {
+      // stored: byte aligned length, its complement, then the bytes
+      s.bitBuf = 0;
+      s.bitCnt = 0;
+      if (s.pos + 4 > s.inLen)
+        return false;
+      uint32_t n = le16(&in[s.pos]);
+      if ((n ^ le16(&in[s.pos + 2])) != 0xFFFF || s.pos + 4 + n > s.inLen)
+        return false;
+      out.insert(out.end(), in + s.pos + 4, in + s.pos + 4 + n);
+      s.pos += 4 + n;
+    }
+    else if (type == 1)
+      inflateFixed(s);
+    else if (type == 2)
+      inflateDynamic(s);
+    else
+      return false;
+  } while (!last && !s.error);
+
+  return !s.error;
+}
+
+static uint8_t paeth(int a, int b, int c)
+{
+  int p = a + b - c;
+  int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+  return (pa <= pb && pa <= pc) ? a : (pb <= pc) ? b : c;
+}
+
+static bool loadPng(const Bytes &d, int &w, int &h, Bytes &gray)
+{
+  Bytes idat, palette, alpha;
+  int depth = 0, type = -1;
+  size_t i = 8;
+
+  while (i + 12 <= d.size())
+  {
+    uint32_t len = be32(&d[i]);
+    const uint8_t *tag = &d[i + 4];
+    const uint8_t *data = &d[i + 8];
+    if (len > d.size() - i - 12)
+      return false;
+
+    if (!memcmp(tag, "IHDR", 4) && len >= 13)
+    {
+      w = (int)be32(data);
+      h = (int)be32(data + 4);
+      depth = data[8];
+      type = data[9];
+      if (data[12] != 0)
+      {
+        fprintf(stderr, "ssd1322_convert: interlaced PNG is not supported\n");
+        return false;
+      }
+    }
+    else if (!memcmp(tag, "PLTE", 4))
+      palette.assign(data, data + len);
+    else if (!memcmp(tag, "tRNS", 4))
+      alpha.assign(data, data + len);
+    else if (!memcmp(tag, "IDAT", 4))
+      idat.insert(idat.end(), data, data + len);
+    else if (!memcmp(tag, "IEND", 4))
+      break;
+    i += 12 + len;
+  }
+
+  static const int channelsOf[7] = { 1, 0, 3, 1, 2, 0, 4 };
+  if (w <= 0 || h <= 0 || w > 65535 || h > 65535 || type < 0 || type > 6 || !channelsOf[type] || idat.size() < 2)
+    return false;
+  if (depth != 1 && depth != 2 && depth != 4 && depth != 8 && depth != 16)
+    return false;
+
+  int channels = channelsOf[type];
+  size_t pixelBytes = std::max(1, channels * depth / 8);
+  size_t rowBytes = ((size_t)w * channels * depth + 7) / 8;
+
+  // zlib: 2 byte header, deflate data, adler32
+  Bytes raw;
+  if ((idat[0] & 0x0F) != 8 || !inflate(&idat[2], idat.size() - 2, raw) || raw.size() < (rowBytes + 1) * h)
+    return false;
+
+  Bytes prev(rowBytes, 0), row(rowBytes);
+  gray.resize((size_t)w * h);
+
+  for (int y = 0; y < h; y++)
+  {
+    const uint8_t *f = &raw[(rowBytes + 1) * y];
+    uint8_t filter = f[0];
+    for (size_t k = 0; k < rowBytes; k++)
+    {
+      int a = (k >= pixelBytes) ? row[k - pixelBytes] : 0;
+      int b = prev[k];
+      int c = (k >= pixelBytes) ? prev[k - pixelBytes] : 0;
+      int v = f[1 + k];
+      switch (filter)
+      {
+        case 1: v += a; break;
+        case 2: v += b; break;
+        case 3: v += (a + b) >> 1; break;
+        case 4: v += paeth(a, b, c); break;
+      }
+      row[k] = (uint8_t)v;
+    }
+
+    for (int x = 0; x < w; x++)
+    {
+      // channel c of this pixel, scaled to 8 bits
+      int sample[4] = { 0, 0, 0, 255 };
+      for (int c = 0; c < channels; c++)
+      {
+        size_t bit = ((size_t)x * channels + c) * depth;
+        int v;
+        if (depth >= 8)
+          v = row[bit / 8];	// the high byte of 16 bit samples
+        else
+          v = (row[bit / 8] >> (8 - depth - (bit & 7))) & ((1 << depth) - 1);
+        sample[c] = v;
+      }
+
+      int r, g, b, a = 255;
+      if (type == 3)
+      {
+        int idx = sample[0];
+        r = (3 * idx + 2 < (int)palette.size()) ? palette[3 * idx] : 0;
+        g = (3 * idx + 2 < (int)palette.size()) ? palette[3 * idx + 1] : 0;
+        b = (3 * idx + 2 < (int)palette.size()) ? palette[3 * idx + 2] : 0;
+        if (idx < (int)alpha.size())
+          a = alpha[idx];
+      }
+      else
+      {
+        int scale = (depth < 8) ? 255 / ((1 << depth) - 1) : 1;
+        for (int c = 0; c < channels; c++)
+          sample[c] *= scale;
+        if (type == 0 || type == 4)
+        {
+          r = g = b = sample[0];
+          if (type == 4)
+            a = sample[1];
+        }
+        else
+        {
+          r = sample[0];
+          g = sample[1];
+          b = sample[2];
+          if (type == 6)
+            a = sample[3];
+        }
+      }
+      gray[(size_t)y * w + x] = (uint8_t)((toGray(r, g, b) * a + 127) / 255);
+    }
+    prev = row;
+  }
+  return true;
+}
+
+static bool loadImage(const char *path, int &w, int &h, Bytes &gray)
+{
+  Bytes d;
+  if (!readFile(path, d) || d.size() < 8)
+    return false;
+
+  if (d[0] == 'P' && (d[1] == '4' || d[1] == '5'))
+    return loadPnm(d, w, h, gray);
+  if (d[0] == 'B' && d[1] == 'M')
+    return loadBmp(d, w, h, gray);
+  if (!memcmp(&d[0], "\x89PNG\r\n\x1a\n", 8))
+    return loadPng(d, w, h, gray);
+  return false;
+}
+
+/*
+ * Quantising
+ */
+
+#define DITHER_NONE 0
+#define DITHER_ORDERED 1
+#define DITHER_FS 2
+
+// 8x8 Bayer matrix, 0..63
+static const uint8_t bayer8[8][8] = {
+  {  0, 32,  8, 40,  2, 34, 10, 42 },
+  { 48, 16, 56, 24, 50, 18, 58, 26 },
+  { 12, 44,  4, 36, 14, 46,  6, 38 },
+  { 60, 28, 52, 20, 62, 30, 54, 22 },
+  {  3, 35, 11, 43,  1, 33,  9, 41 },
+  { 51, 19, 59, 27, 49, 17, 57, 25 },
+  { 15, 47,  7, 39, 13, 45,  5, 37 },
+  { 63, 31, 55, 23, 61, 29, 53, 21 }
+};
+
+// Turn 8 bit gray into levels 0 .. top (1 or 15)
+static void quantise(const Bytes &gray, int w, int h, int top, int mode, int threshold, Bytes &level)
+{
+  level.resize(gray.size());
+
+  if (mode == DITHER_FS)
+  {
+    // errors in 1/16ths of an 8 bit step, this row and the next
+    std::vector<int> cur(w + 2, 0), next(w + 2, 0);
+    for (int y = 0; y < h; y++)
+    {
+      for (int x = 0; x < w; x++)
+      {
+        int v = gray[(size_t)y * w + x] * 16 + cur[x + 1];
+        int q = (v * top + 255 * 8) / (255 * 16);
+        q = std::max(0, std::min(top, q));
+        level[(size_t)y * w + x] = q;
+
+        int err = v - q * 255 * 16 / top;
+        cur[x + 2] += err * 7 / 16;
+        next[x] += err * 3 / 16;
+        next[x + 1] += err * 5 / 16;
+        next[x + 2] += err / 16;
+      }
+      cur.swap(next);
+      std::fill(next.begin(), next.end(), 0);
+    }
+    return;
+  }
+
+  for (int y = 0; y < h; y++)
+  {
+    for (int x = 0; x < w; x++)
+    {
+      int v = gray[(size_t)y * w + x];
+      int q;
+      if (mode == DITHER_ORDERED)
+        q = (v * top * 64 + bayer8[y & 7][x & 7] * 255) / (255 * 64);
+      else if (top == 1)
+        q = v >= threshold;
+      else
+        q = (v * top + 127) / 255;
+      level[(size_t)y * w + x] = std::min(top, q);
+    }
+  }
+}
+
+/*
+ * Output
+ */
+
+// PackBits one row
+static void packRow(const uint8_t *row, size_t n, Bytes &out)
+{
+  size_t i = 0;
+  while (i < n)
+  {
+    // a run of 2 or more repeats
+    size_t run = 1;
+    while (i + run < n && run < 128 && row[i + run] == row[i])
+      run++;
+    if (run >= 2)
+    {
+      out.push_back((uint8_t)(257 - run));
+      out.push_back(row[i]);
+      i += run;
+      continue;
+    }
+
+    // literals up to the next run of 3 (a run of 2 inside costs the same)
+    size_t start = i;
+    while (i < n && i - start < 128)
+    {
+      if (i + 2 < n && row[i] == row[i + 1] && row[i] == row[i + 2])
+        break;
+      i++;
+    }
+    out.push_back((uint8_t)(i - start - 1));
+    out.insert(out.end(), row + start, row + i);
+  }
+}
+
+// Pack levels into buffer format rows, w pixels of out of srcW
+static void packRows(const Bytes &level, int srcW, int w, int h, int bpp, Bytes &out)
+{
+  size_t stride = ((size_t)w * bpp + 7) / 8;
+  out.assign(stride * h, 0);
+
+  for (int y = 0; y < h; y++)
+  {
+    uint8_t *row = &out[stride * y];
+    for (int x = 0; x < srcW; x++)
+    {
+      uint8_t q = level[(size_t)y * srcW + x];
+      if (bpp == 4)
+        row[x >> 1] |= q << ((x & 1) ? 0 : 4);
+      else if (q)
+        row[x >> 3] |= 0x80 >> (x & 7);
+    }
+  }
+}
+
+// A C name from the file name: no directory, no extension
+static std::string arrayName(const char *path)
+{
+  std::string base = path;
+  size_t slash = base.find_last_of("/\\");
+  if (slash != std::string::npos)
+    base = base.substr(slash + 1);
+  size_t dot = base.find('.');
+  if (dot != std::string::npos)
+    base = base.substr(0, dot);
+
+  std::string name;
+  for (size_t i = 0; i < base.size(); i++)
+    name += isalnum((uint8_t)base[i]) ? base[i] : '_';
+  if (name.empty() || isdigit((uint8_t)name[0]))
+    name = "img_" + name;
+  return name;
+}
+
+static std::string upper(std::string s)
+{
+  for (size_t i = 0; i < s.size(); i++)
+    s[i] = toupper((uint8_t)s[i]);
+  return s;
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: ssd1322_convert [-1|-4] [-d none|ordered|fs] [-t threshold] [-i] [-a] [-r] [-n name] image...\n");
+  exit(1);
+}
+
+int main(int argc, char **argv)
+{
+  int bpp = 4;
+  int dither = DITHER_NONE;
+  int threshold = 128;
+  bool invert = false, align = false, rle = false;
+  const char *name = NULL;
+  std::vector<const char *> paths;
+
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    if (a == "-1")
+      bpp = 1;
+    else if (a == "-4")
+      bpp = 4;
+    else if (a == "-i")
+      invert = true;
+    else if (a == "-a")
+      align = true;
+    else if (a == "-r")
+      rle = true;
+    else if (a == "-t" && i + 1 < argc)
+      threshold = atoi(argv[++i]);
+    else if (a == "-n" && i + 1 < argc)
+      name = argv[++i];
+    else if (a == "-d" && i + 1 < argc)
+    {
+      std::string m = argv[++i];
+      if (m == "none")
+        dither = DITHER_NONE;
+      else if (m == "ordered")
+        dither = DITHER_ORDERED;
+      else if (m == "fs")
+        dither = DITHER_FS;
+      else
+        usage();
+    }
+    else if (a[0] != '-')
+      paths.push_back(argv[i]);
+    else
+      usage();
+  }
+  if (paths.empty() || (name && paths.size() > 1))
+    usage();
+
+  size_t total = 0;
+  printf("// Made by ssd1322_convert: %d bit%s per pixel%s\n", bpp, (bpp > 1) ? "s" : "", rle ? ", RLE" : "");
+
+  for (size_t p = 0; p < paths.size(); p++)
+  {
+    int w = 0, h = 0;
+    Bytes gray, level, out;
+
+    if (!loadImage(paths[p], w, h, gray))
+    {
+      fprintf(stderr, "ssd1322_convert: cannot read %s\n", paths[p]);
+      return 1;
+    }
+    if (invert)
+      for (size_t k = 0; k < gray.size(); k++)
+        gray[k] = 255 - gray[k];
+
+    int outW = align ? (w + 3) & ~3 : w;
+    quantise(gray, w, h, (bpp == 4) ? 15 : 1, dither, threshold, level);
+    packRows(level, w, outW, h, bpp, out);
+    size_t rawBytes = out.size();
+
+    if (rle)
+    {
+      size_t stride = ((size_t)outW * bpp + 7) / 8;
+      Bytes packed;
+      packed.push_back(bpp);
+      packed.push_back(outW & 0xFF);
+      packed.push_back(outW >> 8);
+      packed.push_back(h & 0xFF);
+      packed.push_back(h >> 8);
+      for (int y = 0; y < h; y++)
+        packRow(&out[stride * y], stride, packed);
+      out.swap(packed);
+    }
+
+    std::string n = name ? name : arrayName(paths[p]);
+    printf("\n// %s: %d x %d, %u bytes\n", paths[p], outW, h, (unsigned)out.size());
+    printf("#define %s_WIDTH %d\n", upper(n).c_str(), outW);
+    printf("#define %s_HEIGHT %d\n", upper(n).c_str(), h);
+    printf("static const uint8_t %s[] PROGMEM = {", n.c_str());
+    for (size_t k = 0; k < out.size(); k++)
+      printf("%s0x%02X%s", (k % 16) ? "" : "\n  ", out[k], (k + 1 < out.size()) ? "," : "");
+    printf("\n};\n");
+
+    fprintf(stderr, "%-24s %4d x %-3d %6u bytes", n.c_str(), outW, h, (unsigned)out.size());
+    if (rle)
+      fprintf(stderr, " (raw %u, %u%%)", (unsigned)rawBytes, (unsigned)(out.size() * 100 / rawBytes));
+    fprintf(stderr, "\n");
+    total += out.size();
+  }
+
+  if (paths.size() > 1)
+    fprintf(stderr, "%-24s %17u bytes\n", "total", (unsigned)total);
+  return 0;
+}
@@ -0,0 +1,707 @@
+/**
+ * Make fonts for the ESP8266_SSD1322 library, from its own fonts or from
+ * BDF and TrueType files.  Runs on the host, not on the board.
+ *
+ * Build:  g++ -O2 -o ssd1322_font ssd1322_font.cpp
+ *         (from extras/tools, it includes the font sources of the library)
+ *         For TrueType fonts add FreeType:
+ *         g++ -O2 -DSSD1322_FREETYPE $(pkg-config --cflags freetype2) \
+ *             -o ssd1322_font ssd1322_font.cpp -lfreetype
+ * Use:    ssd1322_font [options] size > myfont.h
+ *         ssd1322_font [options] -n name font.bdf > myfont.h
+ *         ssd1322_font [options] -n name -p pixels font.ttf > myfont.h
+ *
+ *   size         the library font to convert: 2, 4, 6 or 7, as in drawString()
+ *   font.bdf     a BDF bitmap font, characters 32 to 127
+ *   font.ttf     a TrueType or OpenType font, rendered hinted and anti-aliased
+ *   -p pixels    the height to render a TrueType font at
+ *   -u list      more code points to take from a BDF or TrueType font, past
+ *                32 to 127: hex or decimal, single or first-last, comma
+ *                separated, e.g. 0xB0,0xC0-0xFF,0x400-0x45F
+ *   -r           run length encode the glyphs (SSD1322_FONT_RLE, default)
+ *   -b           plain bitmap rows (SSD1322_FONT_BITMAP)
+ *   -g           4 bit coverage, anti-aliased (SSD1322_FONT_ALPHA), for
+ *                SSD1322_256_64_4 builds
+ *   -s factor    shrink the font, averaging each factor x factor block of
+ *                pixels into one; with -g a big bitmap font becomes a smooth
+ *                small one
+ *   -t           a width table and a table of glyph pointers instead of the
+ *                packed index
+ *   -n name      name of the tables and descriptor (default: f16, f32, ...)
+ *   -c           write a library font source, like Font32.c, instead of a
+ *                header for a sketch
+ *
+ * The header for a sketch holds the glyphs, their index and an SSD1322_Font
+ * descriptor to hand to registerFont().  Glyphs with the same pixels are
+ * stored once.  A report of the bytes goes to stderr.
+ *
+ * The -u code points the font has follow the 96 characters in glyph order,
+ * and runs of consecutive ones become the descriptor's code ranges.  Code
+ * points the font lacks are left out, and drawString() skips them.
+ *
+ * Packed layout: all glyphs in one array, and an index of 32 bit records,
+ * one per character: offset into the array | width << 16, plus
+ * SSD1322_GLYPH_BLANK for a glyph without ink, which stores nothing.
+ *
+ * RLE layout: the glyph's pixels row after row, width pixels a row, as runs
+ * of at most 128 pixels.  A byte with bit 7 set is a run of (b & 0x7F) + 1
+ * ink pixels, otherwise of (b & 0x7F) + 1 background pixels.  Runs carry on
+ * into the next row and cover every pixel of the glyph.
+ *
+ * Alpha layout: rows of (width + 1) / 2 bytes, the coverage of a pixel (0
+ * none, 15 all ink) in each nibble, high nibble left as in the 4 bit buffer.
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <stdint.h>
+#include <vector>
+#include <string>
+#include <algorithm>
+
+#ifdef SSD1322_FREETYPE
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#endif
+
+#include "../../Font16.c"
+#include "../../Font32.c"
+#include "../../Font64.c"
+#include "../../Font7s.c"
+
+// As in ESP8266_SSD1322.h
+#define SSD1322_FONT_BITMAP 0
+#define SSD1322_FONT_RLE 1
+#define SSD1322_FONT_ALPHA 2
+#define SSD1322_GLYPH_BLANK 0x01000000UL
+
+typedef std::vector<uint8_t> Bytes;
+
+typedef struct {
+  int size;
+  const char *name;
+  const char *file;
+  int first, count, height, gap, encoding;
+  const unsigned char *widths;            // tables, or
+  const unsigned char * const *glyphs;
+  const uint32_t *index;                   // packed
+  const unsigned char *data;
+} Builtin;
+
+static const Builtin builtins[] = {
+  { 2, "f16", "Font16", firstchr_f16, nr_chrs_f16, chr_hgt_f16, 1, enc_f16, widtbl_f16, chrtbl_f16, NULL, NULL },
+  { 4, "f32", "Font32", firstchr_f32, nr_chrs_f32, chr_hgt_f32, -3, enc_f32, NULL, NULL, idxtbl_f32, chrdat_f32 },
+  { 6, "f64", "Font64", firstchr_f64, nr_chrs_f64, chr_hgt_f64, -3, enc_f64, NULL, NULL, idxtbl_f64, chrdat_f64 },
+  { 7, "f7s", "Font7s", firstchr_f7s, nr_chrs_f7s, chr_hgt_f7s, 2, enc_f7s, NULL, NULL, idxtbl_f7s, chrdat_f7s },
+};
+
+// A font on its way through: each glyph as one byte per pixel, the pixel's
+// coverage from 0 (background) to 15 (ink).  The count glyphs from first
+// come before the extra code points, which are sorted.
+typedef struct {
+  int first, count, height, gap;
+  std::vector<int> extra;
+  std::vector<int> widths;
+  std::vector<Bytes> pixels;
+} Glyphs;
+
+// Code point of a glyph
+static int codeOf(const Glyphs &g, int c)
+{
+  return (c < g.count) ? g.first + c : g.extra[c - g.count];
+}
+
+// Glyph of a code point, -1 for one not wanted
+static int glyphOf(const Glyphs &g, int code)
+{
+  if (code >= g.first && code < g.first + g.count)
+    return code - g.first;
+  std::vector<int>::const_iterator it = std::lower_bound(g.extra.begin(), g.extra.end(), code);
+  return (it != g.extra.end() && *it == code) ? g.count + (int)(it - g.extra.begin()) : -1;
+}
+
+static int glyphWidth(const Builtin &f, int c)
+{
+  return f.index ? (f.index[c] >> 16) & 0xFF : f.widths[c];
+}
+
+static Bytes decodeGlyph(const Builtin &f, int c)
+{
+  int w = glyphWidth(f, c);
+  const unsigned char *p = f.index ? f.data + (f.index[c] & 0xFFFF) : f.glyphs[c];
+  Bytes px;
+
+  if (f.index && (f.index[c] & SSD1322_GLYPH_BLANK))
+  {
+    px.resize(w * f.height);
+    return px;
+  }
+
+  if (f.encoding == SSD1322_FONT_RLE)
+  {
+    while ((int)px.size() < w * f.height)
+    {
+      uint8_t b = *p++;
+      px.insert(px.end(), (b & 0x7F) + 1, (b & 0x80) ? 15 : 0);
+    }
+    px.resize(w * f.height);
+    return px;
+  }
+
+  int stride = (w + 7) / 8;
+  for (int y = 0; y < f.height; y++)
+    for (int x = 0; x < w; x++)
+      px.push_back(((p[y * stride + x / 8] >> (7 - x % 8)) & 1) * 15);
+  return px;
+}
+
+static Glyphs loadBuiltin(const Builtin &f)
+{
+  Glyphs g;
+
+  g.first = f.first;
+  g.count = f.count;
+  g.height = f.height;
+  g.gap = f.gap;
+  for (int c = 0; c < f.count; c++)
+  {
+    g.widths.push_back(glyphWidth(f, c));
+    g.pixels.push_back(decodeGlyph(f, c));
+  }
+  return g;
+}
+
+static void fail(const char *what, const char *file)
+{
+  fprintf(stderr, "ssd1322_font: %s %s\n", what, file);
+  exit(1);
+}
+
+// An empty glyph, the cell's height, for the loaders to draw into
+static void newGlyph(Glyphs &g, int c, int width)
+{
+  g.widths[c] = width;
+  g.pixels[c].assign(width * g.height, 0);
+}
+
+// Characters 32 to 127 and the extra code points, none loaded yet
+static Glyphs startGlyphs(const std::vector<int> &extra)
+{
+  Glyphs g;
+  g.first = 32;
+  g.count = 96;
+  g.height = 0;
+  g.gap = 0;
+  g.extra = extra;
+  g.widths.assign(g.count + extra.size(), 0);
+  g.pixels.resize(g.count + extra.size());
+  return g;
+}
+
+// Characters the font lacks are blank and zero wide, extra code points it
+// lacks are dropped
+static void settle(Glyphs &g)
+{
+  for (int c = (int)g.widths.size() - 1; c >= 0; c--)
+  {
+    if (!g.pixels[c].empty())
+      continue;
+    if (c < g.count)
+      newGlyph(g, c, 0);
+    else
+    {
+      g.extra.erase(g.extra.begin() + (c - g.count));
+      g.widths.erase(g.widths.begin() + c);
+      g.pixels.erase(g.pixels.begin() + c);
+    }
+  }
+}
+
+// Ink outside the advance is cut off
+static void plot(Glyphs &g, int c, int x, int y, int v)
+{
+  if (x >= 0 && x < g.widths[c] && y >= 0 && y < g.height)
+    g.pixels[c][y * g.widths[c] + x] = v;
+}
+
+// Characters 32 to 127 and the extra code points of a BDF font, each as
+// wide as its advance, the cell as tall as the font's ascent and descent
+static Glyphs loadBdf(const char *file, const std::vector<int> &extra)
+{
+  FILE *fp = fopen(file, "r");
+  if (!fp)
+    fail("cannot read", file);
+
+  Glyphs g = startGlyphs(extra);
+
+  char line[512];
+  int ascent = 0, descent = 0, code = -1, dx = 0, bw = 0, bh = 0, bx = 0, by = 0, row = -1;
+  while (fgets(line, sizeof(line), fp))
+  {
+    if (sscanf(line, "FONT_ASCENT %d", &ascent) == 1 || sscanf(line, "FONT_DESCENT %d", &descent) == 1)
+      g.height = ascent + descent;
+    else if (sscanf(line, "ENCODING %d", &code) == 1)
+      code = glyphOf(g, code);
+    else if (sscanf(line, "DWIDTH %d", &dx) == 1 || sscanf(line, "BBX %d %d %d %d", &bw, &bh, &bx, &by) == 4)
+      ;
+    else if (!strncmp(line, "BITMAP", 6))
+    {
+      row = -1;
+      if (code >= 0 && g.height)
+      {
+        newGlyph(g, code, dx);
+        row = 0;
+      }
+    }
+    else if (!strncmp(line, "ENDCHAR", 7))
+      row = -1;
+    else if (row >= 0)
+    {
+      // a row of hex digits, MSB left
+      int y = ascent - by - bh + row++;
+      for (int x = 0; x < bw && isxdigit(line[x / 4]); x++)
+      {
+        char h[2] = { line[x / 4], 0 };
+        if (strtol(h, NULL, 16) & (8 >> (x % 4)))
+          plot(g, code, bx + x, y, 15);
+      }
+    }
+  }
+  fclose(fp);
+
+  if (!g.height)
+    fail("no FONT_ASCENT and FONT_DESCENT in", file);
+  settle(g);
+  return g;
+}
+
+#ifdef SSD1322_FREETYPE
+// Characters 32 to 127 and the extra code points of a TrueType font, hinted
+// and anti-aliased at the given pixel height
+static Glyphs loadFreeType(const char *file, int pixels, const std::vector<int> &extra)
+{
+  FT_Library lib;
+  FT_Face face;
+  if (FT_Init_FreeType(&lib) || FT_New_Face(lib, file, 0, &face))
+    fail("cannot load", file);
+  FT_Set_Pixel_Sizes(face, 0, pixels);
+
+  Glyphs g = startGlyphs(extra);
+  int ascent = face->size->metrics.ascender >> 6;
+  g.height = ascent - (face->size->metrics.descender >> 6);
+
+  for (int c = 0; c < (int)g.widths.size(); c++)
+  {
+    int code = codeOf(g, c);
+    if (c >= g.count && !FT_Get_Char_Index(face, code))
+      continue;
+    newGlyph(g, c, 0);
+    if (FT_Load_Char(face, code, FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL))
+      continue;
+
+    FT_GlyphSlot s = face->glyph;
+    newGlyph(g, c, (s->advance.x + 32) >> 6);
+    for (int y = 0; y < (int)s->bitmap.rows; y++)
+      for (int x = 0; x < (int)s->bitmap.width; x++)
+      {
+        int v = s->bitmap.buffer[y * s->bitmap.pitch + x];
+        plot(g, c, s->bitmap_left + x, ascent - s->bitmap_top + y, (v * 15 + 127) / 255);
+      }
+  }
+  FT_Done_Face(face);
+  FT_Done_FreeType(lib);
+  settle(g);
+  return g;
+}
+#endif
+
+// Each factor x factor block of pixels becomes one pixel of their mean
+// coverage
+static void shrink(Glyphs &g, int factor)
+{
+  int h = (g.height + factor - 1) / factor;
+
+  for (int c = 0; c < (int)g.widths.size(); c++)
+  {
+    int w0 = g.widths[c];
+    int w = (w0 + factor - 1) / factor;
+    Bytes px(w * h, 0);
+
+    for (int y = 0; y < h; y++)
+      for (int x = 0; x < w; x++)
+      {
+        int sum = 0;
+        for (int j = y * factor; j < (y + 1) * factor && j < g.height; j++)
+          for (int i = x * factor; i < (x + 1) * factor && i < w0; i++)
+            sum += g.pixels[c][j * w0 + i];
+        px[y * w + x] = (sum + factor * factor / 2) / (factor * factor);
+      }
+    g.widths[c] = w;
+    g.pixels[c] = px;
+  }
+  g.height = h;
+  g.gap = (g.gap < 0) ? -((-g.gap + factor / 2) / factor) : (g.gap + factor / 2) / factor;
+}
+
+// At least half covered pixels are ink in the one bit encodings
+static bool isInk(uint8_t v)
+{
+  return v >= 8;
+}
+
+static Bytes encodeBitmap(const Bytes &px, int w, int h)
+{
+  int stride = (w + 7) / 8;
+  Bytes out(stride * h, 0);
+
+  for (int y = 0; y < h; y++)
+    for (int x = 0; x < w; x++)
+      if (isInk(px[y * w + x]))
+        out[y * stride + x / 8] |= 0x80 >> (x % 8);
+  return out;
+}
+
+static Bytes encodeRle(const Bytes &px)
+{
+  Bytes out;
+
+  for (size_t i = 0; i < px.size();)
+  {
+    size_t j = i;
+    while (j < px.size() && isInk(px[j]) == isInk(px[i]) && j - i < 128)
+      j++;
+    out.push_back((isInk(px[i]) ? 0x80 : 0x00) | (uint8_t)(j - i - 1));
+    i = j;
+  }
+  return out;
+}
+
+static Bytes encodeAlpha(const Bytes &px, int w, int h)
+{
+  int stride = (w + 1) / 2;
+  Bytes out(stride * h, 0);
+
+  for (int y = 0; y < h; y++)
+    for (int x = 0; x < w; x++)
+      out[y * stride + x / 2] |= px[y * w + x] << ((x & 1) ? 0 : 4);
+  return out;
+}
+
+static void usage(void)
+{
+  fprintf(stderr, "usage: ssd1322_font [-r | -b | -g] [-s factor] [-t] [-n name] [-c] size\n"
+                  "       ssd1322_font [-r | -b | -g] [-s factor] [-t] [-u list] -n name font.bdf\n"
+                  "       ssd1322_font [-r | -b | -g] [-s factor] [-t] [-u list] -n name -p pixels font.ttf\n");
+  exit(2);
+}
+
+// A -u list, sorted, without the characters every font has
+static std::vector<int> parseCodes(const char *list)
+{
+  std::vector<int> codes;
+  const char *p = list;
+
+  while (*p)
+  {
+    char *end;
+    long lo = strtol(p, &end, 0), hi = lo;
+    if (end == p)
+      usage();
+    p = end;
+    if (*p == '-')
+    {
+      hi = strtol(++p, &end, 0);
+      if (end == p)
+        usage();
+      p = end;
+    }
+    if (*p == ',')
+      p++;
+    else if (*p)
+      usage();
+    if (lo < 0 || hi > 0xFFFF || lo > hi)
+      usage();
+    for (long c = lo; c <= hi; c++)
+      if (c < 32 || c > 127)
+        codes.push_back(c);
+  }
+  std::sort(codes.begin(), codes.end());
+  codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+  return codes;
+}
+
+// The extra code points as runs of consecutive ones, the descriptor's ranges.
+// Returns how the descriptor ends.
+static std::string printRanges(const Glyphs &g, const std::string &n)
+{
+  std::vector<int> first, count;
+  for (size_t k = 0; k < g.extra.size(); k++)
+  {
+    if (k && g.extra[k] == g.extra[k - 1] + 1)
+      count.back()++;
+    else
+    {
+      first.push_back(g.extra[k]);
+      count.push_back(1);
+    }
+  }
+  if (first.empty())
+    return "NULL, 0";
+
+  printf("\nstatic const SSD1322_CodeRange %s_ranges[%u] PROGMEM = {  // first, count, glyph\n",
+         n.c_str(), (unsigned)first.size());
+  int glyph = g.count;
+  for (size_t k = 0; k < first.size(); k++)
+  {
+    printf("  { 0x%04X, %d, %d }%s\n", first[k], count[k], glyph, (k + 1 < first.size()) ? "," : "");
+    glyph += count[k];
+  }
+  printf("};\n");
+  return n + "_ranges, " + std::to_string(first.size());
+}
+
+int main(int argc, char **argv)
+{
+  int encoding = SSD1322_FONT_RLE;
+  bool source = false, tables = false;
+  int factor = 1, pixels = 0;
+  const char *name = NULL, *file = NULL;
+  const Builtin *font = NULL;
+  std::vector<int> extra;
+
+  for (int i = 1; i < argc; i++)
+  {
+    std::string a = argv[i];
+    if (a == "-r")
+      encoding = SSD1322_FONT_RLE;
+    else if (a == "-b")
+      encoding = SSD1322_FONT_BITMAP;
+    else if (a == "-g")
+      encoding = SSD1322_FONT_ALPHA;
+    else if (a == "-t")
+      tables = true;
+    else if (a == "-c")
+      source = true;
+    else if (a == "-n" && i + 1 < argc)
+      name = argv[++i];
+    else if (a == "-s" && i + 1 < argc)
+      factor = atoi(argv[++i]);
+    else if (a == "-p" && i + 1 < argc)
+      pixels = atoi(argv[++i]);
+    else if (a == "-u" && i + 1 < argc)
+      extra = parseCodes(argv[++i]);
+    else if (isdigit(a[0]) && !font && !file)
+    {
+      for (size_t k = 0; k < sizeof(builtins) / sizeof(builtins[0]); k++)
+        if (builtins[k].size == atoi(argv[i]))
+          font = &builtins[k];
+      if (!font)
+        usage();
+    }
+    else if (a[0] != '-' && !font && !file)
+      file = argv[i];
+    else
+      usage();
+  }
+  // a library source stands in for one of the library's own fonts, which
+  // have 32 to 127 only
+  if ((!font && !file) || (file && !name) || (source && !font) || (font && !extra.empty()) || factor < 1)
+    usage();
+
+  Glyphs g;
+  std::string from;
+  if (font)
+  {
+    g = loadBuiltin(*font);
+    from = "font size " + std::to_string(font->size);
+  }
+  else if (strlen(file) > 4 && !strcmp(file + strlen(file) - 4, ".bdf"))
+  {
+    g = loadBdf(file, extra);
+    from = file;
+  }
+  else
+  {
+#ifdef SSD1322_FREETYPE
+    if (pixels <= 0)
+      usage();
+    g = loadFreeType(file, pixels, extra);
+    from = file;
+#else
+    (void)pixels;
+    fail("built without SSD1322_FREETYPE, cannot read", file);
+#endif
+  }
+  if (factor > 1)
+    shrink(g, factor);
+
+  std::string n = name ? name : font->name;
+  const char *enc = (encoding == SSD1322_FONT_RLE) ? "SSD1322_FONT_RLE" :
+                    (encoding == SSD1322_FONT_ALPHA) ? "SSD1322_FONT_ALPHA" : "SSD1322_FONT_BITMAP";
+
+  // encode, storing glyphs with the same bytes once; packed, a glyph without
+  // ink stores nothing (index -1)
+  int glyphs = g.widths.size();
+  std::vector<Bytes> data;
+  std::vector<int> index(glyphs);
+  size_t before = 0, after = 0;
+  for (int c = 0; c < glyphs; c++)
+  {
+    int w = g.widths[c];
+    const Bytes &px = g.pixels[c];
+    Bytes out = (encoding == SSD1322_FONT_RLE) ? encodeRle(px) :
+                (encoding == SSD1322_FONT_ALPHA) ? encodeAlpha(px, w, g.height) : encodeBitmap(px, w, g.height);
+    uint8_t most = 0;
+    for (size_t i = 0; i < px.size(); i++)
+      most = std::max(most, px[i]);
+    if (out.empty())
+      out.push_back(0);           // a character the font lacks, no zero length arrays
+
+    before += ((w + 7) / 8) * g.height;
+    index[c] = -1;
+    if (!tables && (encoding == SSD1322_FONT_ALPHA ? most == 0 : !isInk(most)))
+      continue;
+    for (size_t k = 0; k < data.size(); k++)
+      if (data[k] == out)
+        index[c] = k;
+    if (index[c] < 0)
+    {
+      index[c] = data.size();
+      data.push_back(out);
+      after += out.size();
+    }
+  }
+
+  // glyph arrays are named after the first character using them
+  std::vector<std::string> arrays(data.size());
+  std::vector<int> owner(data.size());
+  for (int c = glyphs - 1; c >= 0; c--)
+  {
+    char buf[64];
+    snprintf(buf, sizeof(buf), "chr_%s_%02X", n.c_str(), codeOf(g, c));
+    if (index[c] >= 0)
+    {
+      arrays[index[c]] = buf;
+      owner[index[c]] = codeOf(g, c);
+    }
+  }
+
+  const char *layout = (encoding == SSD1322_FONT_RLE) ?
+      "// Runs of pixels across the rows: bit 7 set ink, clear background, length (b & 0x7F) + 1\n" :
+      (encoding == SSD1322_FONT_ALPHA) ? "// Row format, 4 bit coverage, high nibble left\n" : "// Row format, MSB left\n";
+
+  if (source)
+  {
+    printf("// Font size %d, %s by ssd1322_font\n\n", font->size,
+           (encoding == SSD1322_FONT_RLE) ? "run length encoded" : "made");
+    printf("#include \"%s.h\"\n\n", font->file);
+    printf("#ifdef __AVR__\n #include <avr/io.h>\n #include <avr/pgmspace.h>\n"
+           "#elif defined(ESP8266)\n #include <pgmspace.h>\n#else\n #define PROGMEM\n#endif\n\n");
+  }
+  else
+  {
+    printf("// Made by ssd1322_font from %s, %s\n", from.c_str(), enc);
+  }
+
+  if (!tables)
+  {
+    // one array of glyphs, and one record per character
+    std::vector<size_t> offset(data.size());
+    size_t total = 0;
+    for (size_t k = 0; k < data.size(); k++)
+    {
+      offset[k] = total;
+      total += data[k].size();
+    }
+    if (total > 0xFFFF)
+    {
+      fprintf(stderr, "ssd1322_font: %u glyph bytes, more than a 16 bit offset reaches\n", (unsigned)total);
+      return 1;
+    }
+
+    if (source)
+      printf("PROGMEM const uint32_t idxtbl_%s[%d] =         // offset | width << 16, or SSD1322_GLYPH_BLANK\n{", n.c_str(), g.count);
+    else
+      printf("static const uint32_t %s_index[%d] PROGMEM = {", n.c_str(), glyphs);
+    for (int c = 0; c < glyphs; c++)
+    {
+      uint32_t r = (uint32_t)g.widths[c] << 16;
+      r |= (index[c] < 0) ? SSD1322_GLYPH_BLANK : offset[index[c]];
+      printf("%s0x%08X%s", (c % 8) ? " " : "\n  ", (unsigned)r, (c + 1 < glyphs) ? "," : "");
+    }
+    printf("\n};\n");
+
+    if (source)
+      printf("\n%s", layout);
+
+    if (source)
+      printf("\nPROGMEM const unsigned char chrdat_%s[%u] =\n{", n.c_str(), (unsigned)total);
+    else
+      printf("\nstatic const uint8_t %s_data[%u] PROGMEM = {", n.c_str(), (unsigned)total);
+    for (size_t k = 0; k < data.size(); k++)
+    {
+      const Bytes &d = data[k];
+      if (owner[k] < 127)
+        printf("\n  // 0x%02X '%c', offset %u", owner[k], owner[k], (unsigned)offset[k]);
+      else
+        printf("\n  // U+%04X, offset %u", owner[k], (unsigned)offset[k]);
+      for (size_t i = 0; i < d.size(); i++)
+        printf("%s0x%02X%s", (i % 16) ? " " : "\n  ", d[i], (i + 1 < d.size() || k + 1 < data.size()) ? "," : "");
+    }
+    printf("\n};\n");
+
+    if (!source)
+    {
+      std::string ranges = printRanges(g, n);
+      printf("\nstatic const SSD1322_Font %s = {\n  %d, %d, %d, %d, NULL, NULL, %s, %s_index, %s_data, %s\n};\n",
+             n.c_str(), g.first, g.count, g.height, g.gap, enc, n.c_str(), n.c_str(), ranges.c_str());
+    }
+
+    fprintf(stderr, "%s: %u glyph bytes, %u distinct glyphs, %u byte index (bitmaps %u bytes)\n", n.c_str(),
+            (unsigned)after, (unsigned)data.size(), (unsigned)(4 * glyphs), (unsigned)before);
+    return 0;
+  }
+
+  if (source)
+    printf("PROGMEM const unsigned char widtbl_%s[%d] =         // character width table\n{", n.c_str(), g.count);
+  else
+    printf("static const uint8_t %s_widths[%d] PROGMEM = {", n.c_str(), glyphs);
+  for (int c = 0; c < glyphs; c++)
+    printf("%s%d%s", (c % 16) ? " " : "\n  ", g.widths[c], (c + 1 < glyphs) ? "," : "");
+  printf("\n};\n");
+
+  if (source)
+    printf("\n%s", layout);
+
+  for (size_t k = 0; k < data.size(); k++)
+  {
+    const Bytes &d = data[k];
+    if (source)
+      printf("\nPROGMEM const unsigned char %s[%u] =\n{", arrays[k].c_str(), (unsigned)d.size());
+    else
+      printf("\nstatic const uint8_t %s[%u] PROGMEM = {", arrays[k].c_str(), (unsigned)d.size());
+    for (size_t i = 0; i < d.size(); i++)
+      printf("%s0x%02X%s", (i % 16) ? " " : "\n  ", d[i], (i + 1 < d.size()) ? "," : "");
+    printf("\n};\n");
+  }
+
+  if (source)
+    printf("\nPROGMEM const unsigned char* const chrtbl_%s[%d] =       // character pointer table\n{", n.c_str(), g.count);
+  else
+    printf("\nstatic const uint8_t * const %s_glyphs[%d] PROGMEM = {", n.c_str(), glyphs);
+  for (int c = 0; c < glyphs; c++)
+    printf("%s%s%s", (c % 8) ? " " : "\n  ", arrays[index[c]].c_str(), (c + 1 < glyphs) ? "," : "");
+  printf("\n};\n");
+
+  if (!source)
+  {
+    std::string ranges = printRanges(g, n);
+    printf("\nstatic const SSD1322_Font %s = {\n  %d, %d, %d, %d, %s_widths, %s_glyphs, %s, NULL, NULL, %s\n};\n",
+           n.c_str(), g.first, g.count, g.height, g.gap, n.c_str(), n.c_str(), enc, ranges.c_str());
+  }
+
+  fprintf(stderr, "%s: %u glyph bytes, %u distinct glyphs (bitmaps %u bytes)\n", n.c_str(),
+          (unsigned)after, (unsigned)data.size(), (unsigned)before);
+  return 0;
+}